@@ -0,0 +1,32 @@
+/*
+Copyright 2026
+
+Distributed under the Boost Software License, Version 1.0.
+(http://www.boost.org/LICENSE_1_0.txt)
+*/
+#ifndef BOOST_CORE_ALLOCATION_RESULT_HPP
+#define BOOST_CORE_ALLOCATION_RESULT_HPP
+
+#include <boost/config.hpp>
+#include <cstddef>
+/* <memory> defines __cpp_lib_allocate_at_least, so that every translation
+unit sees the same allocation_result */
+#include <memory>
+
+namespace boost {
+
+#if defined(__cpp_lib_allocate_at_least) && \
+    (__cpp_lib_allocate_at_least >= 202302L)
+template<class P, class S = std::size_t>
+using allocation_result = std::allocation_result<P, S>;
+#else
+template<class P, class S = std::size_t>
+struct allocation_result {
+    P ptr;
+    S count;
+};
+#endif
+
+} /* boost */
+
+#endif
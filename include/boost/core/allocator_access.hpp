@@ -9,9 +9,12 @@ Distributed under the Boost Software License, Version 1.0.
 #define BOOST_CORE_ALLOCATOR_ACCESS_HPP
 
 #include <boost/config.hpp>
+#include <boost/core/allocation_result.hpp>
+#include <boost/core/is_trivially_relocatable.hpp>
 #include <boost/core/pointer_traits.hpp>
 #include <limits>
 #include <new>
+#include <cstring>
 #if !defined(BOOST_NO_CXX11_ALLOCATOR)
 #include <type_traits>
 #endif
@@ -37,6 +40,11 @@ Distributed under the Boost Software License, Version 1.0.
 #define BOOST_DETAIL_ALLOC_EMPTY(T) __is_empty(T)
 #endif
 
+#if !defined(BOOST_NO_CXX11_ALLOCATOR) && \
+    !(defined(BOOST_LIBSTDCXX_VERSION) && BOOST_LIBSTDCXX_VERSION < 50000)
+#define BOOST_DETAIL_ALLOC_TRIVIAL
+#endif
+
 #if defined(_LIBCPP_SUPPRESS_DEPRECATED_PUSH)
 _LIBCPP_SUPPRESS_DEPRECATED_PUSH
 #endif
@@ -640,6 +648,67 @@ allocator_max_size(const A&) BOOST_NOEXCEPT
 
 namespace detail {
 
+#if defined(BOOST_NO_CXX11_ALLOCATOR)
+template<class A>
+class alloc_has_allocate_at_least {
+    template<class O>
+    static alloc_no<allocation_result<typename allocator_pointer<O>::type,
+        typename allocator_size_type<O>::type>(O::*)(typename
+            allocator_size_type<O>::type), &O::allocate_at_least> check(int);
+
+    template<class>
+    static char check(long);
+
+public:
+    BOOST_STATIC_CONSTEXPR bool value = sizeof(check<A>(0)) > 1;
+};
+#else
+template<class A>
+class alloc_has_allocate_at_least {
+    template<class O>
+    static auto check(int)
+    -> alloc_no<decltype(std::declval<O&>().allocate_at_least(std::declval<
+        typename boost::allocator_size_type<A>::type>()))>;
+
+    template<class>
+    static char check(long);
+
+public:
+    BOOST_STATIC_CONSTEXPR bool value = sizeof(check<A>(0)) > 1;
+};
+#endif
+
+} /* detail */
+
+template<class A>
+inline typename detail::alloc_if<detail::alloc_has_allocate_at_least<A>::value,
+    allocation_result<typename allocator_pointer<A>::type,
+        typename allocator_size_type<A>::type> >::type
+allocator_allocate_at_least(A& a, typename allocator_size_type<A>::type n)
+{
+#if defined(BOOST_NO_CXX11_ALLOCATOR)
+    return a.allocate_at_least(n);
+#else
+    auto r = a.allocate_at_least(n);
+    allocation_result<typename allocator_pointer<A>::type,
+        typename allocator_size_type<A>::type> result = { r.ptr, r.count };
+    return result;
+#endif
+}
+
+template<class A>
+inline typename detail::alloc_if<!detail::alloc_has_allocate_at_least<A>::value,
+    allocation_result<typename allocator_pointer<A>::type,
+        typename allocator_size_type<A>::type> >::type
+allocator_allocate_at_least(A& a, typename allocator_size_type<A>::type n)
+{
+    allocation_result<typename allocator_pointer<A>::type,
+        typename allocator_size_type<A>::type> result = { a.allocate(n), n };
+    return result;
+}
+
+namespace detail {
+
 #if defined(BOOST_NO_CXX11_ALLOCATOR)
 template<class A>
 class alloc_has_soccc {
@@ -692,6 +761,53 @@ allocator_select_on_container_copy_construction(const A& a)
     return a;
 }
 
+#if defined(BOOST_DETAIL_ALLOC_TRIVIAL)
+namespace detail {
+
+template<class A, class T>
+struct alloc_trivial_destroy {
+    BOOST_STATIC_CONSTEXPR bool value = !alloc_has_destroy<A, T>::value &&
+        std::is_trivially_destructible<T>::value;
+};
+
+template<class A, class T>
+struct alloc_trivial_init {
+    BOOST_STATIC_CONSTEXPR bool value = !alloc_has_construct<A, T>::value &&
+        std::is_trivially_default_constructible<T>::value;
+};
+
+template<class A, class T, class V>
+struct alloc_trivial_copy {
+    BOOST_STATIC_CONSTEXPR bool value =
+        !alloc_has_construct<A, T, V&>::value &&
+        std::is_trivially_constructible<T, V&>::value &&
+        std::is_same<typename std::remove_const<V>::type, T>::value;
+};
+
+/* zero bits are the value of a value initialized object */
+template<class T>
+struct alloc_zero_init {
+    BOOST_STATIC_CONSTEXPR bool value = std::is_scalar<T>::value &&
+        !std::is_member_pointer<T>::value;
+};
+
+} /* detail */
+
+template<class A, class T>
+inline typename detail::alloc_if<detail::alloc_trivial_destroy<A,
+    T>::value>::type
+allocator_destroy_n(A&, T*, std::size_t) { }
+
+template<class A, class T>
+inline typename detail::alloc_if<!detail::alloc_trivial_destroy<A,
+    T>::value>::type
+allocator_destroy_n(A& a, T* p, std::size_t n)
+{
+    while (n > 0) {
+        boost::allocator_destroy(a, p + --n);
+    }
+}
+#else
 template<class A, class T>
 inline void
 allocator_destroy_n(A& a, T* p, std::size_t n)
@@ -700,6 +816,7 @@ allocator_destroy_n(A& a, T* p, std::size_t n)
         boost::allocator_destroy(a, p + --n);
     }
 }
+#endif
 
 namespace detail {
 
@@ -728,8 +845,72 @@ private:
 
 } /* detail */
 
+#if defined(BOOST_DETAIL_ALLOC_TRIVIAL)
+namespace detail {
+
+template<class T>
+inline typename alloc_if<alloc_zero_init<T>::value>::type
+alloc_init_n(T* p, std::size_t n)
+{
+    if (n != 0) {
+        std::memset(static_cast<void*>(p), 0, sizeof(T) * n);
+    }
+}
+
+template<class T>
+inline typename alloc_if<!alloc_zero_init<T>::value>::type
+alloc_init_n(T* p, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        ::new(static_cast<void*>(p + i)) T();
+    }
+}
+
+} /* detail */
+
 template<class A, class T>
-inline void
+inline typename detail::alloc_if<detail::alloc_trivial_init<A,
+    T>::value>::type
+allocator_construct_n(A&, T* p, std::size_t n)
+{
+    detail::alloc_init_n(p, n);
+}
+
+template<class A, class T>
+inline typename detail::alloc_if<detail::alloc_trivial_copy<A, T,
+    const T>::value>::type
+allocator_construct_n(A&, T* p, std::size_t n, const T* l, std::size_t m)
+{
+    if (n == 0) {
+        return;
+    }
+    std::size_t k = m < n ? m : n;
+    std::memcpy(static_cast<void*>(p), l, sizeof(T) * k);
+    while (k < n) {
+        std::size_t c = n - k < k ? n - k : k;
+        std::memcpy(static_cast<void*>(p + k), p, sizeof(T) * c);
+        k += c;
+    }
+}
+
+template<class A, class T, class V>
+inline typename detail::alloc_if<detail::alloc_trivial_copy<A, T,
+    V>::value>::type
+allocator_construct_n(A&, T* p, std::size_t n, V* b)
+{
+    if (n != 0) {
+        std::memmove(static_cast<void*>(p), b, sizeof(T) * n);
+    }
+}
+#endif
+
+template<class A, class T>
+inline
+#if defined(BOOST_DETAIL_ALLOC_TRIVIAL)
+typename detail::alloc_if<!detail::alloc_trivial_init<A, T>::value>::type
+#else
+void
+#endif
 allocator_construct_n(A& a, T* p, std::size_t n)
 {
     detail::alloc_destroyer<A, T> d(a, p);
@@ -740,7 +921,13 @@ allocator_construct_n(A& a, T* p, std::size_t n)
 }
 
 template<class A, class T>
-inline void
+inline
+#if defined(BOOST_DETAIL_ALLOC_TRIVIAL)
+typename detail::alloc_if<!detail::alloc_trivial_copy<A, T,
+    const T>::value>::type
+#else
+void
+#endif
 allocator_construct_n(A& a, T* p, std::size_t n, const T* l, std::size_t m)
 {
     detail::alloc_destroyer<A, T> d(a, p);
@@ -750,8 +937,29 @@ allocator_construct_n(A& a, T* p, std::size_t n, const T* l, std::size_t m)
     d.size() = 0;
 }
 
+#if defined(BOOST_DETAIL_ALLOC_TRIVIAL)
+namespace detail {
+
 template<class A, class T, class I>
-inline void
+struct alloc_trivial_iter {
+    BOOST_STATIC_CONSTEXPR bool value = false;
+};
+
+template<class A, class T, class V>
+struct alloc_trivial_iter<A, T, V*> {
+    BOOST_STATIC_CONSTEXPR bool value = alloc_trivial_copy<A, T, V>::value;
+};
+
+} /* detail */
+#endif
+
+template<class A, class T, class I>
+inline
+#if defined(BOOST_DETAIL_ALLOC_TRIVIAL)
+typename detail::alloc_if<!detail::alloc_trivial_iter<A, T, I>::value>::type
+#else
+void
+#endif
 allocator_construct_n(A& a, T* p, std::size_t n, I b)
 {
     detail::alloc_destroyer<A, T> d(a, p);
@@ -761,6 +969,194 @@ allocator_construct_n(A& a, T* p, std::size_t n, I b)
     d.size() = 0;
 }
 
+namespace detail {
+
+#if defined(BOOST_NO_CXX11_ALLOCATOR)
+template<class A>
+class alloc_has_expand {
+    template<class O>
+    static alloc_no<bool(O::*)(typename allocator_pointer<O>::type,
+        typename allocator_size_type<O>::type, typename
+            allocator_size_type<O>::type), &O::expand> check(int);
+
+    template<class>
+    static char check(long);
+
+public:
+    BOOST_STATIC_CONSTEXPR bool value = sizeof(check<A>(0)) > 1;
+};
+
+template<class A>
+class alloc_has_reallocate {
+    template<class O>
+    static alloc_no<typename allocator_pointer<O>::type(O::*)(typename
+        allocator_pointer<O>::type, typename allocator_size_type<O>::type,
+            typename allocator_size_type<O>::type), &O::reallocate>
+                check(int);
+
+    template<class>
+    static char check(long);
+
+public:
+    BOOST_STATIC_CONSTEXPR bool value = sizeof(check<A>(0)) > 1;
+};
+#else
+template<class A>
+class alloc_has_expand {
+    template<class O>
+    static auto check(int)
+    -> alloc_no<decltype(std::declval<O&>().expand(std::declval<typename
+        boost::allocator_pointer<A>::type>(), std::declval<typename
+            boost::allocator_size_type<A>::type>(), std::declval<typename
+                boost::allocator_size_type<A>::type>()))>;
+
+    template<class>
+    static char check(long);
+
+public:
+    BOOST_STATIC_CONSTEXPR bool value = sizeof(check<A>(0)) > 1;
+};
+
+template<class A>
+class alloc_has_reallocate {
+    template<class O>
+    static auto check(int)
+    -> alloc_no<decltype(std::declval<O&>().reallocate(std::declval<typename
+        boost::allocator_pointer<A>::type>(), std::declval<typename
+            boost::allocator_size_type<A>::type>(), std::declval<typename
+                boost::allocator_size_type<A>::type>()))>;
+
+    template<class>
+    static char check(long);
+
+public:
+    BOOST_STATIC_CONSTEXPR bool value = sizeof(check<A>(0)) > 1;
+};
+#endif
+
+template<class A>
+struct alloc_relocate {
+    BOOST_STATIC_CONSTEXPR bool value = boost::is_trivially_relocatable<
+        typename allocator_value_type<A>::type>::value;
+};
+
+template<class A>
+inline typename alloc_if<alloc_relocate<A>::value &&
+    alloc_has_reallocate<A>::value, bool>::type
+alloc_reallocate(A& a, typename allocator_pointer<A>::type& p,
+    typename allocator_size_type<A>::type n,
+    typename allocator_size_type<A>::type m)
+{
+    p = a.reallocate(p, n, m);
+    return true;
+}
+
+template<class A>
+inline typename alloc_if<!(alloc_relocate<A>::value &&
+    alloc_has_reallocate<A>::value), bool>::type
+alloc_reallocate(A&, typename allocator_pointer<A>::type&,
+    typename allocator_size_type<A>::type,
+    typename allocator_size_type<A>::type)
+{
+    return false;
+}
+
+template<class A, class T>
+inline typename alloc_if<alloc_relocate<A>::value>::type
+alloc_relocate_n(A&, T* p, T* q, std::size_t n)
+{
+    if (n != 0) {
+        std::memcpy(static_cast<void*>(p), static_cast<const void*>(q),
+            sizeof(T) * n);
+    }
+}
+
+template<class A, class T>
+inline typename alloc_if<!alloc_relocate<A>::value>::type
+alloc_relocate_n(A& a, T* p, T* q, std::size_t n)
+{
+    detail::alloc_destroyer<A, T> d(a, p);
+    for (std::size_t& i = d.size(); i < n; ++i) {
+#if !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+        boost::allocator_construct(a, p + i, std::move_if_noexcept(q[i]));
+#else
+        boost::allocator_construct(a, p + i, q[i]);
+#endif
+    }
+    d.size() = 0;
+    boost::allocator_destroy_n(a, q, n);
+}
+
+template<class A>
+class alloc_deallocator {
+public:
+    alloc_deallocator(A& a, typename allocator_pointer<A>::type p,
+        typename allocator_size_type<A>::type n) BOOST_NOEXCEPT
+        : a_(a), p_(p), n_(n), owns_(true) { }
+
+    ~alloc_deallocator() {
+        if (owns_) {
+            a_.deallocate(p_, n_);
+        }
+    }
+
+    void release() BOOST_NOEXCEPT {
+        owns_ = false;
+    }
+
+private:
+    alloc_deallocator(const alloc_deallocator&);
+    alloc_deallocator& operator=(const alloc_deallocator&);
+
+    A& a_;
+    typename allocator_pointer<A>::type p_;
+    typename allocator_size_type<A>::type n_;
+    bool owns_;
+};
+
+} /* detail */
+
+template<class A>
+inline typename detail::alloc_if<detail::alloc_has_expand<A>::value,
+    bool>::type
+allocator_expand(A& a, typename allocator_pointer<A>::type p,
+    typename allocator_size_type<A>::type n,
+    typename allocator_size_type<A>::type m)
+{
+    return a.expand(p, n, m);
+}
+
+template<class A>
+inline typename detail::alloc_if<!detail::alloc_has_expand<A>::value,
+    bool>::type
+allocator_expand(A&, typename allocator_pointer<A>::type,
+    typename allocator_size_type<A>::type,
+    typename allocator_size_type<A>::type)
+{
+    return false;
+}
+
+template<class A>
+inline typename allocator_pointer<A>::type
+allocator_reallocate(A& a, typename allocator_pointer<A>::type p,
+    typename allocator_size_type<A>::type n,
+    typename allocator_size_type<A>::type m,
+    typename allocator_size_type<A>::type k)
+{
+    if (m == n || (m > n && boost::allocator_expand(a, p, n, m))) {
+        return p;
+    }
+    if (detail::alloc_reallocate(a, p, n, m)) {
+        return p;
+    }
+    typename allocator_pointer<A>::type q = a.allocate(m);
+    detail::alloc_deallocator<A> d(a, q, m);
+    detail::alloc_relocate_n(a, boost::to_address(q), boost::to_address(p), k);
+    d.release();
+    a.deallocate(p, n);
+    return q;
+}
+
 #if !defined(BOOST_NO_CXX11_TEMPLATE_ALIASES)
 template<class A>
 using allocator_value_type_t = typename allocator_value_type<A>::type;
@@ -807,6 +1203,8 @@ using allocator_rebind_t = typename allocator_rebind<A, T>::type;
 
 } /* boost */
 
+#undef BOOST_DETAIL_ALLOC_TRIVIAL
+
 #if defined(_LIBCPP_SUPPRESS_DEPRECATED_POP)
 _LIBCPP_SUPPRESS_DEPRECATED_POP
 #endif
@@ -20,6 +20,16 @@
 #include <boost/cstdint.hpp>
 #include <limits>
 #include <cstring>
+#include <cstddef>
+
+#include <boost/core/detail/is_constant_evaluated.hpp>
+#include <boost/core/detail/simd.hpp>
+
+#if !defined(BOOST_NO_CXX11_CONSTEXPR) && !defined(BOOST_NO_CXX11_DECLTYPE)
+# include <boost/core/span.hpp>
+# include <type_traits>
+# define BOOST_CORE_BIT_HAS_SPAN
+#endif
 
 #if defined(_MSC_VER)
 
@@ -32,6 +42,11 @@
 #  pragma intrinsic(_BitScanReverse64)
 # endif
 
+# include <stdlib.h>
+# pragma intrinsic(_byteswap_ushort)
+# pragma intrinsic(_byteswap_ulong)
+# pragma intrinsic(_byteswap_uint64)
+
 # pragma warning(push)
 # pragma warning(disable: 4127) // conditional expression is constant
 # pragma warning(disable: 4244) // conversion from int to T
@@ -55,6 +70,39 @@ To bit_cast( From const & from ) BOOST_NOEXCEPT
     return to;
 }
 
+// numeric_limits is not specialized for the 128 bit integers in
+// strict ISO mode
+
+namespace detail
+{
+
+template<class T> struct bit_traits
+{
+    static const int digits = std::numeric_limits<T>::digits;
+    static const bool is_integer = std::numeric_limits<T>::is_integer;
+    static const bool is_signed = std::numeric_limits<T>::is_signed;
+};
+
+#if defined(BOOST_HAS_INT128)
+
+template<> struct bit_traits<boost::int128_type>
+{
+    static const int digits = 127;
+    static const bool is_integer = true;
+    static const bool is_signed = true;
+};
+
+template<> struct bit_traits<boost::uint128_type>
+{
+    static const int digits = 128;
+    static const bool is_integer = true;
+    static const bool is_signed = false;
+};
+
+#endif
+
+} // namespace detail
+
 // countl
 
 #if defined(__GNUC__) || defined(__clang__)
@@ -87,6 +135,17 @@ BOOST_CONSTEXPR inline int countl_impl( boost::ulong_long_type x ) BOOST_NOEXCEP
     return x? __builtin_clzll( x ): std::numeric_limits<boost::ulong_long_type>::digits;
 }
 
+#if defined(BOOST_HAS_INT128)
+
+BOOST_CONSTEXPR inline int countl_impl( boost::uint128_type x ) BOOST_NOEXCEPT
+{
+    return static_cast<boost::ulong_long_type>( x >> 64 ) != 0?
+        boost::core::detail::countl_impl( static_cast<boost::ulong_long_type>( x >> 64 ) ):
+        boost::core::detail::countl_impl( static_cast<boost::ulong_long_type>( x ) ) + 64;
+}
+
+#endif
+
 } // namespace detail
 
 template<class T>
@@ -229,6 +288,17 @@ BOOST_CONSTEXPR inline int countr_impl( boost::ulong_long_type x ) BOOST_NOEXCEP
     return x? __builtin_ctzll( x ): std::numeric_limits<boost::ulong_long_type>::digits;
 }
 
+#if defined(BOOST_HAS_INT128)
+
+BOOST_CONSTEXPR inline int countr_impl( boost::uint128_type x ) BOOST_NOEXCEPT
+{
+    return static_cast<boost::ulong_long_type>( x ) != 0?
+        boost::core::detail::countr_impl( static_cast<boost::ulong_long_type>( x ) ):
+        boost::core::detail::countr_impl( static_cast<boost::ulong_long_type>( x >> 64 ) ) + 64;
+}
+
+#endif
+
 } // namespace detail
 
 template<class T>
@@ -370,6 +440,15 @@ BOOST_CORE_POPCOUNT_CONSTEXPR inline int popcount_impl( boost::ulong_long_type x
     return __builtin_popcountll( x );
 }
 
+#if defined(BOOST_HAS_INT128)
+
+BOOST_CORE_POPCOUNT_CONSTEXPR inline int popcount_impl( boost::uint128_type x ) BOOST_NOEXCEPT
+{
+    return __builtin_popcountll( static_cast<boost::ulong_long_type>( x ) ) + __builtin_popcountll( static_cast<boost::ulong_long_type>( x >> 64 ) );
+}
+
+#endif
+
 } // namespace detail
 
 #undef BOOST_CORE_POPCOUNT_CONSTEXPR
@@ -422,19 +501,496 @@ BOOST_CXX14_CONSTEXPR int popcount( T x ) BOOST_NOEXCEPT
 
 #endif // defined(__GNUC__) || defined(__clang__)
 
+// popcount over a span of words
+
+#if defined(BOOST_CORE_BIT_HAS_SPAN)
+
+namespace detail
+{
+
+// The bits set in the words are the bits set in their bytes, so the
+// runtime versions count the bits of the object representation.
+//
+// Without a popcount instruction, 16 words are first reduced with a
+// tree of carry-save adders (Harley-Seal), so that only five popcounts
+// per 16 words remain.
+
+template<class T> inline void popcount_csa( T& h, T& l, T a, T b, T c ) BOOST_NOEXCEPT
+{
+    T const u = a ^ b;
+
+    h = ( a & b ) | ( u & c );
+    l = u ^ c;
+}
+
+inline std::size_t popcount_bytes_scalar( unsigned char const* p, std::size_t n ) BOOST_NOEXCEPT
+{
+    std::size_t r = 0;
+    std::size_t i = 0;
+
+#if !defined(__POPCNT__)
+
+    if( n >= 128 )
+    {
+        boost::uint64_t ones = 0, twos = 0, fours = 0, eights = 0, sixteens = 0;
+        boost::uint64_t twos_a = 0, twos_b = 0, fours_a = 0, fours_b = 0, eights_a = 0, eights_b = 0;
+
+        std::size_t r16 = 0;
+
+        for( ; i + 128 <= n; i += 128 )
+        {
+            boost::uint64_t w[ 16 ];
+            std::memcpy( w, p + i, 128 );
+
+            detail::popcount_csa( twos_a, ones, ones, w[ 0 ], w[ 1 ] );
+            detail::popcount_csa( twos_b, ones, ones, w[ 2 ], w[ 3 ] );
+            detail::popcount_csa( fours_a, twos, twos, twos_a, twos_b );
+            detail::popcount_csa( twos_a, ones, ones, w[ 4 ], w[ 5 ] );
+            detail::popcount_csa( twos_b, ones, ones, w[ 6 ], w[ 7 ] );
+            detail::popcount_csa( fours_b, twos, twos, twos_a, twos_b );
+            detail::popcount_csa( eights_a, fours, fours, fours_a, fours_b );
+            detail::popcount_csa( twos_a, ones, ones, w[ 8 ], w[ 9 ] );
+            detail::popcount_csa( twos_b, ones, ones, w[ 10 ], w[ 11 ] );
+            detail::popcount_csa( fours_a, twos, twos, twos_a, twos_b );
+            detail::popcount_csa( twos_a, ones, ones, w[ 12 ], w[ 13 ] );
+            detail::popcount_csa( twos_b, ones, ones, w[ 14 ], w[ 15 ] );
+            detail::popcount_csa( fours_b, twos, twos, twos_a, twos_b );
+            detail::popcount_csa( eights_b, fours, fours, fours_a, fours_b );
+            detail::popcount_csa( sixteens, eights, eights, eights_a, eights_b );
+
+            r16 += boost::core::popcount( sixteens );
+        }
+
+        r = 16 * r16 + 8 * boost::core::popcount( eights ) + 4 * boost::core::popcount( fours ) + 2 * boost::core::popcount( twos ) + boost::core::popcount( ones );
+    }
+
+#endif
+
+    for( ; i + 8 <= n; i += 8 )
+    {
+        boost::uint64_t w = 0;
+        std::memcpy( &w, p + i, 8 );
+
+        r += boost::core::popcount( w );
+    }
+
+    for( ; i < n; ++i )
+    {
+        r += boost::core::popcount( p[ i ] );
+    }
+
+    return r;
+}
+
+#if defined(BOOST_CORE_AVX512VPOPCNTDQ)
+
+inline std::size_t popcount_bytes( unsigned char const* p, std::size_t n ) BOOST_NOEXCEPT
+{
+    __m512i acc = _mm512_setzero_si512();
+
+    std::size_t i = 0;
+
+    for( ; i + 64 <= n; i += 64 )
+    {
+        acc = _mm512_add_epi64( acc, _mm512_popcnt_epi64( _mm512_loadu_si512( p + i ) ) );
+    }
+
+    boost::uint64_t t[ 8 ];
+    _mm512_storeu_si512( t, acc );
+
+    return static_cast<std::size_t>( t[ 0 ] + t[ 1 ] + t[ 2 ] + t[ 3 ] + t[ 4 ] + t[ 5 ] + t[ 6 ] + t[ 7 ] ) + detail::popcount_bytes_scalar( p + i, n - i );
+}
+
+#elif defined(BOOST_CORE_AVX2)
+
+// Harley-Seal over 16 vectors of 32 bytes, with the popcounts of the
+// vectors computed by nibble lookups (Mula, Kurz, Lemire, "Faster
+// Population Counts Using AVX2 Instructions", 2018)
+
+inline __m256i popcount_m256( __m256i v ) BOOST_NOEXCEPT
+{
+    __m256i const lookup = _mm256_setr_epi8(
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 );
+
+    __m256i const m0f = _mm256_set1_epi8( 0x0F );
+
+    __m256i const lo = _mm256_shuffle_epi8( lookup, _mm256_and_si256( v, m0f ) );
+    __m256i const hi = _mm256_shuffle_epi8( lookup, _mm256_and_si256( _mm256_srli_epi16( v, 4 ), m0f ) );
+
+    // four 64 bit sums
+    return _mm256_sad_epu8( _mm256_add_epi8( lo, hi ), _mm256_setzero_si256() );
+}
+
+inline void popcount_csa_m256( __m256i& h, __m256i& l, __m256i a, __m256i b, __m256i c ) BOOST_NOEXCEPT
+{
+    __m256i const u = _mm256_xor_si256( a, b );
+
+    h = _mm256_or_si256( _mm256_and_si256( a, b ), _mm256_and_si256( u, c ) );
+    l = _mm256_xor_si256( u, c );
+}
+
+inline std::size_t popcount_bytes( unsigned char const* p, std::size_t n ) BOOST_NOEXCEPT
+{
+    __m256i total = _mm256_setzero_si256();
+
+    std::size_t i = 0;
+
+    if( n >= 512 )
+    {
+        __m256i ones = _mm256_setzero_si256(), twos = ones, fours = ones, eights = ones, sixteens = ones;
+        __m256i twos_a, twos_b, fours_a, fours_b, eights_a, eights_b;
+
+        for( ; i + 512 <= n; i += 512 )
+        {
+            __m256i const* d = reinterpret_cast<__m256i const*>( p + i );
+
+            detail::popcount_csa_m256( twos_a, ones, ones, _mm256_loadu_si256( d + 0 ), _mm256_loadu_si256( d + 1 ) );
+            detail::popcount_csa_m256( twos_b, ones, ones, _mm256_loadu_si256( d + 2 ), _mm256_loadu_si256( d + 3 ) );
+            detail::popcount_csa_m256( fours_a, twos, twos, twos_a, twos_b );
+            detail::popcount_csa_m256( twos_a, ones, ones, _mm256_loadu_si256( d + 4 ), _mm256_loadu_si256( d + 5 ) );
+            detail::popcount_csa_m256( twos_b, ones, ones, _mm256_loadu_si256( d + 6 ), _mm256_loadu_si256( d + 7 ) );
+            detail::popcount_csa_m256( fours_b, twos, twos, twos_a, twos_b );
+            detail::popcount_csa_m256( eights_a, fours, fours, fours_a, fours_b );
+            detail::popcount_csa_m256( twos_a, ones, ones, _mm256_loadu_si256( d + 8 ), _mm256_loadu_si256( d + 9 ) );
+            detail::popcount_csa_m256( twos_b, ones, ones, _mm256_loadu_si256( d + 10 ), _mm256_loadu_si256( d + 11 ) );
+            detail::popcount_csa_m256( fours_a, twos, twos, twos_a, twos_b );
+            detail::popcount_csa_m256( twos_a, ones, ones, _mm256_loadu_si256( d + 12 ), _mm256_loadu_si256( d + 13 ) );
+            detail::popcount_csa_m256( twos_b, ones, ones, _mm256_loadu_si256( d + 14 ), _mm256_loadu_si256( d + 15 ) );
+            detail::popcount_csa_m256( fours_b, twos, twos, twos_a, twos_b );
+            detail::popcount_csa_m256( eights_b, fours, fours, fours_a, fours_b );
+            detail::popcount_csa_m256( sixteens, eights, eights, eights_a, eights_b );
+
+            total = _mm256_add_epi64( total, detail::popcount_m256( sixteens ) );
+        }
+
+        total = _mm256_slli_epi64( total, 4 );
+        total = _mm256_add_epi64( total, _mm256_slli_epi64( detail::popcount_m256( eights ), 3 ) );
+        total = _mm256_add_epi64( total, _mm256_slli_epi64( detail::popcount_m256( fours ), 2 ) );
+        total = _mm256_add_epi64( total, _mm256_slli_epi64( detail::popcount_m256( twos ), 1 ) );
+        total = _mm256_add_epi64( total, detail::popcount_m256( ones ) );
+    }
+
+    for( ; i + 32 <= n; i += 32 )
+    {
+        total = _mm256_add_epi64( total, detail::popcount_m256( _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + i ) ) ) );
+    }
+
+    boost::uint64_t t[ 4 ];
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( t ), total );
+
+    return static_cast<std::size_t>( t[ 0 ] + t[ 1 ] + t[ 2 ] + t[ 3 ] ) + detail::popcount_bytes_scalar( p + i, n - i );
+}
+
+#else
+
+inline std::size_t popcount_bytes( unsigned char const* p, std::size_t n ) BOOST_NOEXCEPT
+{
+    return detail::popcount_bytes_scalar( p, n );
+}
+
+#endif
+
+} // namespace detail
+
+template<class T, std::size_t E>
+BOOST_CXX14_CONSTEXPR std::size_t popcount( span<T, E> s ) BOOST_NOEXCEPT
+{
+    typedef typename std::remove_cv<T>::type U;
+
+    static_assert( std::is_integral<U>::value && std::is_unsigned<U>::value && !std::is_same<U, bool>::value, "popcount requires a span of unsigned integers" );
+
+#if defined(BOOST_CORE_HAS_BUILTIN_IS_CONSTANT_EVALUATED) || defined(BOOST_NO_CXX14_CONSTEXPR)
+
+    if( !boost::core::detail::is_constant_evaluated() )
+    {
+        return boost::core::detail::popcount_bytes( reinterpret_cast<unsigned char const*>( s.data() ), s.size_bytes() );
+    }
+
+#endif
+
+    std::size_t r = 0;
+
+    for( std::size_t i = 0; i < s.size(); ++i )
+    {
+        r += boost::core::popcount( s[ i ] );
+    }
+
+    return r;
+}
+
+#endif // defined(BOOST_CORE_BIT_HAS_SPAN)
+
+// bit deposit and extract
+
+#if defined(BOOST_CORE_BMI2) && ( defined(BOOST_CORE_HAS_BUILTIN_IS_CONSTANT_EVALUATED) || defined(BOOST_NO_CXX14_CONSTEXPR) )
+# define BOOST_CORE_BIT_USE_BMI2
+#endif
+
+namespace detail
+{
+
+// One iteration per set bit of the mask
+
+template<class T>
+BOOST_CXX14_CONSTEXPR T bit_deposit_impl( T x, T mask ) BOOST_NOEXCEPT
+{
+    T r = 0;
+
+    for( T b = 1; mask != 0; b = static_cast<T>( b << 1 ) )
+    {
+        if( x & b )
+        {
+            r = static_cast<T>( r | ( mask & static_cast<T>( ~mask + 1 ) ) );
+        }
+
+        mask = static_cast<T>( mask & ( mask - 1 ) );
+    }
+
+    return r;
+}
+
+template<class T>
+BOOST_CXX14_CONSTEXPR T bit_extract_impl( T x, T mask ) BOOST_NOEXCEPT
+{
+    T r = 0;
+
+    for( T b = 1; mask != 0; b = static_cast<T>( b << 1 ) )
+    {
+        if( x & mask & static_cast<T>( ~mask + 1 ) )
+        {
+            r = static_cast<T>( r | b );
+        }
+
+        mask = static_cast<T>( mask & ( mask - 1 ) );
+    }
+
+    return r;
+}
+
+#if defined(BOOST_CORE_BIT_USE_BMI2)
+
+inline boost::uint32_t bit_deposit_bmi2( boost::uint32_t x, boost::uint32_t mask ) BOOST_NOEXCEPT
+{
+    return _pdep_u32( x, mask );
+}
+
+inline boost::uint32_t bit_extract_bmi2( boost::uint32_t x, boost::uint32_t mask ) BOOST_NOEXCEPT
+{
+    return _pext_u32( x, mask );
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+inline boost::uint64_t bit_deposit_bmi2( boost::uint64_t x, boost::uint64_t mask ) BOOST_NOEXCEPT
+{
+    return _pdep_u64( x, mask );
+}
+
+inline boost::uint64_t bit_extract_bmi2( boost::uint64_t x, boost::uint64_t mask ) BOOST_NOEXCEPT
+{
+    return _pext_u64( x, mask );
+}
+
+#else
+
+// 32 bit x86 only has the 32 bit instructions
+
+inline boost::uint64_t bit_deposit_bmi2( boost::uint64_t x, boost::uint64_t mask ) BOOST_NOEXCEPT
+{
+    boost::uint32_t const m0 = static_cast<boost::uint32_t>( mask );
+    boost::uint32_t const m1 = static_cast<boost::uint32_t>( mask >> 32 );
+
+    boost::uint32_t const r0 = _pdep_u32( static_cast<boost::uint32_t>( x ), m0 );
+    boost::uint32_t const r1 = _pdep_u32( static_cast<boost::uint32_t>( x >> boost::core::popcount( m0 ) ), m1 );
+
+    return static_cast<boost::uint64_t>( r1 ) << 32 | r0;
+}
+
+inline boost::uint64_t bit_extract_bmi2( boost::uint64_t x, boost::uint64_t mask ) BOOST_NOEXCEPT
+{
+    boost::uint32_t const m0 = static_cast<boost::uint32_t>( mask );
+    boost::uint32_t const m1 = static_cast<boost::uint32_t>( mask >> 32 );
+
+    boost::uint64_t const r0 = _pext_u32( static_cast<boost::uint32_t>( x ), m0 );
+    boost::uint64_t const r1 = _pext_u32( static_cast<boost::uint32_t>( x >> 32 ), m1 );
+
+    return r1 << boost::core::popcount( m0 ) | r0;
+}
+
+#endif
+
+#if defined(BOOST_HAS_INT128)
+
+inline boost::uint128_type bit_deposit_bmi2( boost::uint128_type x, boost::uint128_type mask ) BOOST_NOEXCEPT
+{
+    boost::uint64_t const m0 = static_cast<boost::uint64_t>( mask );
+    boost::uint64_t const m1 = static_cast<boost::uint64_t>( mask >> 64 );
+
+    boost::uint128_type const r0 = detail::bit_deposit_bmi2( static_cast<boost::uint64_t>( x ), m0 );
+    boost::uint128_type const r1 = detail::bit_deposit_bmi2( static_cast<boost::uint64_t>( x >> boost::core::popcount( m0 ) ), m1 );
+
+    return r1 << 64 | r0;
+}
+
+inline boost::uint128_type bit_extract_bmi2( boost::uint128_type x, boost::uint128_type mask ) BOOST_NOEXCEPT
+{
+    boost::uint64_t const m0 = static_cast<boost::uint64_t>( mask );
+    boost::uint64_t const m1 = static_cast<boost::uint64_t>( mask >> 64 );
+
+    boost::uint128_type const r0 = detail::bit_extract_bmi2( static_cast<boost::uint64_t>( x ), m0 );
+    boost::uint128_type const r1 = detail::bit_extract_bmi2( static_cast<boost::uint64_t>( x >> 64 ), m1 );
+
+    return r1 << boost::core::popcount( m0 ) | r0;
+}
+
+#endif
+
+// the argument type of bit_deposit_bmi2 and bit_extract_bmi2 for T
+
+template<std::size_t N> struct bit_bmi2_word
+{
+    typedef boost::uint32_t type;
+};
+
+template<> struct bit_bmi2_word<8>
+{
+    typedef boost::uint64_t type;
+};
+
+#if defined(BOOST_HAS_INT128)
+
+template<> struct bit_bmi2_word<16>
+{
+    typedef boost::uint128_type type;
+};
+
+#endif
+
+#endif // defined(BOOST_CORE_BIT_USE_BMI2)
+
+} // namespace detail
+
+// bit_deposit( x, mask ) places the low bits of x, in order, at the
+// positions of the set bits of mask (PDEP); bit_extract( x, mask ) is
+// the inverse, and gathers the bits of x at the positions of the set
+// bits of mask into the low bits of the result (PEXT)
+
+template<class T>
+BOOST_CXX14_CONSTEXPR T bit_deposit( T x, T mask ) BOOST_NOEXCEPT
+{
+    BOOST_STATIC_ASSERT( boost::core::detail::bit_traits<T>::is_integer && !boost::core::detail::bit_traits<T>::is_signed );
+
+#if defined(BOOST_CORE_BIT_USE_BMI2)
+
+    if( !boost::core::detail::is_constant_evaluated() )
+    {
+        typedef typename boost::core::detail::bit_bmi2_word<sizeof(T)>::type U;
+        return static_cast<T>( boost::core::detail::bit_deposit_bmi2( static_cast<U>( x ), static_cast<U>( mask ) ) );
+    }
+
+#endif
+
+    return boost::core::detail::bit_deposit_impl( x, mask );
+}
+
+template<class T>
+BOOST_CXX14_CONSTEXPR T bit_extract( T x, T mask ) BOOST_NOEXCEPT
+{
+    BOOST_STATIC_ASSERT( boost::core::detail::bit_traits<T>::is_integer && !boost::core::detail::bit_traits<T>::is_signed );
+
+#if defined(BOOST_CORE_BIT_USE_BMI2)
+
+    if( !boost::core::detail::is_constant_evaluated() )
+    {
+        typedef typename boost::core::detail::bit_bmi2_word<sizeof(T)>::type U;
+        return static_cast<T>( boost::core::detail::bit_extract_bmi2( static_cast<U>( x ), static_cast<U>( mask ) ) );
+    }
+
+#endif
+
+    return boost::core::detail::bit_extract_impl( x, mask );
+}
+
+// select( x, k ) returns the position of the k-th (counting from zero)
+// set bit of x, or the number of bits of T if x has k or fewer set bits
+// or if k is negative
+
+namespace detail
+{
+
+// Narrows the window containing the bit by halving it, with a
+// popcount per step
+
+template<class T>
+BOOST_CXX14_CONSTEXPR int select_impl( T x, int k ) BOOST_NOEXCEPT
+{
+    int const N = boost::core::detail::bit_traits<T>::digits;
+
+    if( boost::core::popcount( x ) <= k ) return N;
+
+    int r = 0;
+
+    for( int w = N / 2; w > 0; w /= 2 )
+    {
+        T const lo = static_cast<T>( x & static_cast<T>( ( static_cast<T>( 1 ) << w ) - 1 ) );
+        int const c = boost::core::popcount( lo );
+
+        if( k >= c )
+        {
+            k -= c;
+            x = static_cast<T>( x >> w );
+            r += w;
+        }
+        else
+        {
+            x = lo;
+        }
+    }
+
+    return r;
+}
+
+} // namespace detail
+
+template<class T>
+BOOST_CXX14_CONSTEXPR int select( T x, int k ) BOOST_NOEXCEPT
+{
+    BOOST_STATIC_ASSERT( boost::core::detail::bit_traits<T>::is_integer && !boost::core::detail::bit_traits<T>::is_signed );
+
+    int const N = boost::core::detail::bit_traits<T>::digits;
+
+    // k >= N would also shift out of range on the BMI2 path
+
+    if( k < 0 || k >= N ) return N;
+
+#if defined(BOOST_CORE_BIT_USE_BMI2)
+
+    if( !boost::core::detail::is_constant_evaluated() )
+    {
+        return boost::core::countr_zero( boost::core::bit_deposit( static_cast<T>( static_cast<T>( 1 ) << k ), x ) );
+    }
+
+#endif
+
+    return boost::core::detail::select_impl( x, k );
+}
+
+#undef BOOST_CORE_BIT_USE_BMI2
+
 // rotating
 
 template<class T>
 BOOST_CXX14_CONSTEXPR T rotl( T x, int s ) BOOST_NOEXCEPT
 {
-    unsigned const mask = std::numeric_limits<T>::digits - 1;
+    unsigned const mask = boost::core::detail::bit_traits<T>::digits - 1;
     return x << (s & mask) | x >> ((-s) & mask);
 }
 
 template<class T>
 BOOST_CXX14_CONSTEXPR T rotr( T x, int s ) BOOST_NOEXCEPT
 {
-    unsigned const mask = std::numeric_limits<T>::digits - 1;
+    unsigned const mask = boost::core::detail::bit_traits<T>::digits - 1;
     return x >> (s & mask) | x << ((-s) & mask);
 }
 
@@ -452,7 +1008,7 @@ template<class T>
 BOOST_CONSTEXPR T bit_width( T x ) BOOST_NOEXCEPT
 {
     return static_cast<T>(
-        std::numeric_limits<T>::digits - boost::core::countl_zero( x ) );
+        boost::core::detail::bit_traits<T>::digits - boost::core::countl_zero( x ) );
 }
 
 template<class T>
@@ -505,13 +1061,41 @@ BOOST_CXX14_CONSTEXPR inline boost::uint64_t bit_ceil_impl( boost::uint64_t x )
     return x;
 }
 
+// Branch-free; the shift count is masked so that it stays in range for
+// x == 0, where x - 1 has no leading zeros, and x != 0 makes the result
+// 0 there
+
+template<class T>
+BOOST_CONSTEXPR T bit_ceil_countl( T x ) BOOST_NOEXCEPT
+{
+    return static_cast<T>( static_cast<T>( x != 0 ) << ( ( boost::core::detail::bit_traits<T>::digits - boost::core::countl_zero( static_cast<T>( x - 1 ) ) ) & ( boost::core::detail::bit_traits<T>::digits - 1 ) ) );
+}
+
 } // namespace detail
 
 template<class T>
 BOOST_CXX14_CONSTEXPR T bit_ceil( T x ) BOOST_NOEXCEPT
 {
+#if defined(__GNUC__) || defined(__clang__)
+
+    return boost::core::detail::bit_ceil_countl( x );
+
+#else
+
+    // countl_zero is not constexpr here, so constant evaluation
+    // uses the shift cascade
+
     BOOST_STATIC_ASSERT( sizeof(T) <= sizeof(boost::uint64_t) );
 
+#if defined(BOOST_CORE_HAS_BUILTIN_IS_CONSTANT_EVALUATED) || defined(BOOST_NO_CXX14_CONSTEXPR)
+
+    if( !boost::core::detail::is_constant_evaluated() )
+    {
+        return boost::core::detail::bit_ceil_countl( x );
+    }
+
+#endif
+
     BOOST_IF_CONSTEXPR ( sizeof(T) <= sizeof(boost::uint32_t) )
     {
         return static_cast<T>( boost::core::detail::bit_ceil_impl( static_cast<boost::uint32_t>( x ) ) );
@@ -520,6 +1104,8 @@ BOOST_CXX14_CONSTEXPR T bit_ceil( T x ) BOOST_NOEXCEPT
     {
         return static_cast<T>( boost::core::detail::bit_ceil_impl( static_cast<boost::uint64_t>( x ) ) );
     }
+
+#endif
 }
 
 // endian
@@ -583,7 +1169,365 @@ typedef endian::type endian_type;
 
 #endif
 
+// byteswap
+
+namespace detail
+{
+
+BOOST_CONSTEXPR inline boost::uint8_t byteswap_impl( boost::uint8_t x ) BOOST_NOEXCEPT
+{
+    return x;
+}
+
+#if ( defined(__GNUC__) || defined(__clang__) ) && !( defined(BOOST_GCC) && BOOST_GCC < 40800 )
+
+BOOST_CONSTEXPR inline boost::uint16_t byteswap_impl( boost::uint16_t x ) BOOST_NOEXCEPT
+{
+    return __builtin_bswap16( x );
+}
+
+BOOST_CONSTEXPR inline boost::uint32_t byteswap_impl( boost::uint32_t x ) BOOST_NOEXCEPT
+{
+    return __builtin_bswap32( x );
+}
+
+BOOST_CONSTEXPR inline boost::uint64_t byteswap_impl( boost::uint64_t x ) BOOST_NOEXCEPT
+{
+    return __builtin_bswap64( x );
+}
+
+#else
+
+// _byteswap_* are not constexpr; the shifts below are recognized as
+// a byte swap by the optimizers of the other compilers
+
+#if defined(_MSC_VER) && ( defined(BOOST_CORE_HAS_BUILTIN_IS_CONSTANT_EVALUATED) || defined(BOOST_NO_CXX14_CONSTEXPR) )
+# define BOOST_CORE_BIT_MSVC_BYTESWAP
+#endif
+
+BOOST_CXX14_CONSTEXPR inline boost::uint16_t byteswap_impl( boost::uint16_t x ) BOOST_NOEXCEPT
+{
+#if defined(BOOST_CORE_BIT_MSVC_BYTESWAP)
+
+    if( !boost::core::detail::is_constant_evaluated() )
+    {
+        return _byteswap_ushort( x );
+    }
+
+#endif
+
+    return static_cast<boost::uint16_t>( x << 8 | x >> 8 );
+}
+
+BOOST_CXX14_CONSTEXPR inline boost::uint32_t byteswap_impl( boost::uint32_t x ) BOOST_NOEXCEPT
+{
+#if defined(BOOST_CORE_BIT_MSVC_BYTESWAP)
+
+    if( !boost::core::detail::is_constant_evaluated() )
+    {
+        return _byteswap_ulong( x );
+    }
+
+#endif
+
+    x = ( x << 16 ) | ( x >> 16 );
+    return ( ( x & 0x00FF00FF ) << 8 ) | ( ( x >> 8 ) & 0x00FF00FF );
+}
+
+BOOST_CXX14_CONSTEXPR inline boost::uint64_t byteswap_impl( boost::uint64_t x ) BOOST_NOEXCEPT
+{
+#if defined(BOOST_CORE_BIT_MSVC_BYTESWAP)
+
+    if( !boost::core::detail::is_constant_evaluated() )
+    {
+        return _byteswap_uint64( x );
+    }
+
+#endif
+
+    boost::uint64_t const m1 = static_cast<boost::uint64_t>( 0x0000FFFFu ) << 32 | 0x0000FFFFu;
+    boost::uint64_t const m2 = static_cast<boost::uint64_t>( 0x00FF00FFu ) << 32 | 0x00FF00FFu;
+
+    x = ( x << 32 ) | ( x >> 32 );
+    x = ( ( x & m1 ) << 16 ) | ( ( x >> 16 ) & m1 );
+    return ( ( x & m2 ) << 8 ) | ( ( x >> 8 ) & m2 );
+}
+
+#undef BOOST_CORE_BIT_MSVC_BYTESWAP
+
+#endif
+
+#if defined(BOOST_HAS_INT128)
+
+BOOST_CXX14_CONSTEXPR inline boost::uint128_type byteswap_impl( boost::uint128_type x ) BOOST_NOEXCEPT
+{
+    return static_cast<boost::uint128_type>( detail::byteswap_impl( static_cast<boost::uint64_t>( x ) ) ) << 64 | detail::byteswap_impl( static_cast<boost::uint64_t>( x >> 64 ) );
+}
+
+#endif
+
+} // namespace detail
+
+template<class T>
+BOOST_CXX14_CONSTEXPR T byteswap( T x ) BOOST_NOEXCEPT
+{
+    BOOST_STATIC_ASSERT( boost::core::detail::bit_traits<T>::is_integer );
+
+#if defined(BOOST_HAS_INT128)
+
+    BOOST_STATIC_ASSERT( sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8 || sizeof(T) == 16 );
+
+    BOOST_IF_CONSTEXPR ( sizeof(T) == 16 )
+    {
+        return static_cast<T>( boost::core::detail::byteswap_impl( static_cast<boost::uint128_type>( x ) ) );
+    }
+
+#else
+
+    BOOST_STATIC_ASSERT( sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8 );
+
+#endif
+
+    BOOST_IF_CONSTEXPR ( sizeof(T) == 1 )
+    {
+        return x;
+    }
+    else BOOST_IF_CONSTEXPR ( sizeof(T) == 2 )
+    {
+        return static_cast<T>( boost::core::detail::byteswap_impl( static_cast<boost::uint16_t>( x ) ) );
+    }
+    else BOOST_IF_CONSTEXPR ( sizeof(T) == 4 )
+    {
+        return static_cast<T>( boost::core::detail::byteswap_impl( static_cast<boost::uint32_t>( x ) ) );
+    }
+    else
+    {
+        return static_cast<T>( boost::core::detail::byteswap_impl( static_cast<boost::uint64_t>( x ) ) );
+    }
+}
+
+// unaligned loads and stores in a given byte order
+//
+// These compile to a single load or store, with a byte swap (or MOVBE)
+// when the byte order is not the native one.
+
+namespace detail
+{
+
+inline boost::uint64_t load_bytes_le( unsigned char const* p, std::size_t n ) BOOST_NOEXCEPT
+{
+    boost::uint64_t x = 0;
+
+    for( std::size_t i = n; i > 0; --i )
+    {
+        x = ( x << 8 ) | p[ i - 1 ];
+    }
+
+    return x;
+}
+
+inline void store_bytes_le( unsigned char* p, std::size_t n, boost::uint64_t x ) BOOST_NOEXCEPT
+{
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        p[ i ] = static_cast<unsigned char>( x >> ( i * 8 ) );
+    }
+}
+
+} // namespace detail
+
+template<class T>
+inline T load_le( void const* p ) BOOST_NOEXCEPT
+{
+    BOOST_STATIC_ASSERT( boost::core::detail::bit_traits<T>::is_integer );
+
+    BOOST_IF_CONSTEXPR ( endian::native == endian::little || endian::native == endian::big )
+    {
+        T x;
+        std::memcpy( &x, p, sizeof(T) );
+
+        return endian::native == endian::little? x: boost::core::byteswap( x );
+    }
+    else
+    {
+        return static_cast<T>( boost::core::detail::load_bytes_le( static_cast<unsigned char const*>( p ), sizeof(T) ) );
+    }
+}
+
+template<class T>
+inline T load_be( void const* p ) BOOST_NOEXCEPT
+{
+    return boost::core::byteswap( boost::core::load_le<T>( p ) );
+}
+
+template<class T>
+inline void store_le( void* p, T x ) BOOST_NOEXCEPT
+{
+    BOOST_STATIC_ASSERT( boost::core::detail::bit_traits<T>::is_integer );
+
+    BOOST_IF_CONSTEXPR ( endian::native == endian::little || endian::native == endian::big )
+    {
+        T const y = endian::native == endian::little? x: boost::core::byteswap( x );
+        std::memcpy( p, &y, sizeof(T) );
+    }
+    else
+    {
+        boost::core::detail::store_bytes_le( static_cast<unsigned char*>( p ), sizeof(T), static_cast<boost::uint64_t>( x ) );
+    }
+}
+
+template<class T>
+inline void store_be( void* p, T x ) BOOST_NOEXCEPT
+{
+    boost::core::store_le( p, boost::core::byteswap( x ) );
+}
+
+// byte swapping of arrays
+
+#if defined(BOOST_CORE_BIT_HAS_SPAN)
+
+namespace detail
+{
+
+// Reverses the bytes of each k byte element of p[ 0..n ) into q, which
+// is either p or does not overlap it
+
+inline void byteswap_bytes( unsigned char const* p, unsigned char* q, std::size_t n, std::size_t k ) BOOST_NOEXCEPT
+{
+    std::size_t i = 0;
+
+    if( k == 1 )
+    {
+        if( p != q && n != 0 ) std::memcpy( q, p, n );
+        return;
+    }
+
+#if defined(BOOST_CORE_SSSE3)
+
+    __m128i const mask =
+        k == 2? _mm_setr_epi8( 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14 ):
+        k == 4? _mm_setr_epi8( 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 ):
+                _mm_setr_epi8( 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8 );
+
+#if defined(BOOST_CORE_AVX2)
+
+    {
+        __m256i const mask2 = _mm256_broadcastsi128_si256( mask );
+
+        for( ; i + 32 <= n; i += 32 )
+        {
+            __m256i const x = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + i ) );
+            _mm256_storeu_si256( reinterpret_cast<__m256i*>( q + i ), _mm256_shuffle_epi8( x, mask2 ) );
+        }
+    }
+
+#endif
+
+    for( ; i + 16 <= n; i += 16 )
+    {
+        __m128i const x = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + i ) );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( q + i ), _mm_shuffle_epi8( x, mask ) );
+    }
+
+#endif
+
+    for( ; i < n; i += k )
+    {
+        unsigned char t[ 8 ];
+        std::memcpy( t, p + i, k );
+
+        for( std::size_t j = 0; j < k; ++j )
+        {
+            q[ i + j ] = t[ k - 1 - j ];
+        }
+    }
+}
+
+template<class T> inline void load_span( span<T> s, void const* p, bool swap ) BOOST_NOEXCEPT
+{
+    if( swap )
+    {
+        detail::byteswap_bytes( static_cast<unsigned char const*>( p ), reinterpret_cast<unsigned char*>( s.data() ), s.size_bytes(), sizeof(T) );
+    }
+    else if( s.size() != 0 )
+    {
+        std::memcpy( s.data(), p, s.size_bytes() );
+    }
+}
+
+template<class T> inline void store_span( void* p, span<T const> s, bool swap ) BOOST_NOEXCEPT
+{
+    if( swap )
+    {
+        detail::byteswap_bytes( reinterpret_cast<unsigned char const*>( s.data() ), static_cast<unsigned char*>( p ), s.size_bytes(), sizeof(T) );
+    }
+    else if( s.size() != 0 )
+    {
+        std::memcpy( p, s.data(), s.size_bytes() );
+    }
+}
+
+} // namespace detail
+
+// reverses the bytes of every element of `s`
+
+template<class T, std::size_t E>
+inline void byteswap_inplace( span<T, E> s ) BOOST_NOEXCEPT
+{
+    BOOST_STATIC_ASSERT( std::numeric_limits<T>::is_integer );
+    BOOST_STATIC_ASSERT( sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8 );
+
+    unsigned char* p = reinterpret_cast<unsigned char*>( s.data() );
+    boost::core::detail::byteswap_bytes( p, p, s.size_bytes(), sizeof(T) );
+}
+
+// load the elements of `s` from s.size_bytes() bytes at `p`, and store
+// them to `p`, in the given byte order
+
+template<class T, std::size_t E>
+inline void load_le( span<T, E> s, void const* p ) BOOST_NOEXCEPT
+{
+    BOOST_STATIC_ASSERT( std::numeric_limits<T>::is_integer );
+    BOOST_STATIC_ASSERT( endian::native == endian::little || endian::native == endian::big );
+
+    boost::core::detail::load_span<T>( s, p, endian::native != endian::little );
+}
+
+template<class T, std::size_t E>
+inline void load_be( span<T, E> s, void const* p ) BOOST_NOEXCEPT
+{
+    BOOST_STATIC_ASSERT( std::numeric_limits<T>::is_integer );
+    BOOST_STATIC_ASSERT( endian::native == endian::little || endian::native == endian::big );
+
+    boost::core::detail::load_span<T>( s, p, endian::native != endian::big );
+}
+
+template<class T, std::size_t E>
+inline void store_le( void* p, span<T, E> s ) BOOST_NOEXCEPT
+{
+    typedef typename std::remove_cv<T>::type U;
+
+    BOOST_STATIC_ASSERT( std::numeric_limits<U>::is_integer );
+    BOOST_STATIC_ASSERT( endian::native == endian::little || endian::native == endian::big );
+
+    boost::core::detail::store_span<U>( p, s, endian::native != endian::little );
+}
+
+template<class T, std::size_t E>
+inline void store_be( void* p, span<T, E> s ) BOOST_NOEXCEPT
+{
+    typedef typename std::remove_cv<T>::type U;
+
+    BOOST_STATIC_ASSERT( std::numeric_limits<U>::is_integer );
+    BOOST_STATIC_ASSERT( endian::native == endian::little || endian::native == endian::big );
+
+    boost::core::detail::store_span<U>( p, s, endian::native != endian::big );
+}
+
+#endif // defined(BOOST_CORE_BIT_HAS_SPAN)
+
 #undef BOOST_CORE_BIT_NATIVE_INITIALIZER
+#undef BOOST_CORE_BIT_HAS_SPAN
 
 } // namespace core
 } // namespace boost
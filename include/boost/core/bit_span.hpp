@@ -0,0 +1,445 @@
+#ifndef BOOST_CORE_BIT_SPAN_HPP_INCLUDED
+#define BOOST_CORE_BIT_SPAN_HPP_INCLUDED
+
+// MS compatible compilers support #pragma once
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+// boost::core::bit_span
+// boost::core::const_bit_span
+//
+// A non-owning view of a bitmap stored in an array of uint64_t words,
+// with word-at-a-time set operations, find_first/find_next and rank.
+// Bit i is bit i % 64 of word i / 64.
+//
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/span.hpp>
+#include <boost/core/bit.hpp>
+#include <boost/core/detail/simd.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <type_traits>
+#include <cstddef>
+
+namespace boost
+{
+namespace core
+{
+namespace detail
+{
+
+// The bulk operations process 2 (SSE2) or 4 (AVX2) words at a time;
+// the word operations are given as function objects
+
+struct bit_span_and
+{
+    boost::uint64_t operator()( boost::uint64_t a, boost::uint64_t b ) const BOOST_NOEXCEPT { return a & b; }
+
+#if defined(BOOST_CORE_SSE2)
+    __m128i operator()( __m128i a, __m128i b ) const BOOST_NOEXCEPT { return _mm_and_si128( a, b ); }
+#endif
+
+#if defined(BOOST_CORE_AVX2)
+    __m256i operator()( __m256i a, __m256i b ) const BOOST_NOEXCEPT { return _mm256_and_si256( a, b ); }
+#endif
+};
+
+struct bit_span_or
+{
+    boost::uint64_t operator()( boost::uint64_t a, boost::uint64_t b ) const BOOST_NOEXCEPT { return a | b; }
+
+#if defined(BOOST_CORE_SSE2)
+    __m128i operator()( __m128i a, __m128i b ) const BOOST_NOEXCEPT { return _mm_or_si128( a, b ); }
+#endif
+
+#if defined(BOOST_CORE_AVX2)
+    __m256i operator()( __m256i a, __m256i b ) const BOOST_NOEXCEPT { return _mm256_or_si256( a, b ); }
+#endif
+};
+
+struct bit_span_xor
+{
+    boost::uint64_t operator()( boost::uint64_t a, boost::uint64_t b ) const BOOST_NOEXCEPT { return a ^ b; }
+
+#if defined(BOOST_CORE_SSE2)
+    __m128i operator()( __m128i a, __m128i b ) const BOOST_NOEXCEPT { return _mm_xor_si128( a, b ); }
+#endif
+
+#if defined(BOOST_CORE_AVX2)
+    __m256i operator()( __m256i a, __m256i b ) const BOOST_NOEXCEPT { return _mm256_xor_si256( a, b ); }
+#endif
+};
+
+// a & ~b
+
+struct bit_span_andnot
+{
+    boost::uint64_t operator()( boost::uint64_t a, boost::uint64_t b ) const BOOST_NOEXCEPT { return a & ~b; }
+
+#if defined(BOOST_CORE_SSE2)
+    __m128i operator()( __m128i a, __m128i b ) const BOOST_NOEXCEPT { return _mm_andnot_si128( b, a ); }
+#endif
+
+#if defined(BOOST_CORE_AVX2)
+    __m256i operator()( __m256i a, __m256i b ) const BOOST_NOEXCEPT { return _mm256_andnot_si256( b, a ); }
+#endif
+};
+
+// ~( a & b )
+
+struct bit_span_nand
+{
+    boost::uint64_t operator()( boost::uint64_t a, boost::uint64_t b ) const BOOST_NOEXCEPT { return ~( a & b ); }
+
+#if defined(BOOST_CORE_SSE2)
+    __m128i operator()( __m128i a, __m128i b ) const BOOST_NOEXCEPT { return _mm_andnot_si128( _mm_and_si128( a, b ), _mm_set1_epi32( -1 ) ); }
+#endif
+
+#if defined(BOOST_CORE_AVX2)
+    __m256i operator()( __m256i a, __m256i b ) const BOOST_NOEXCEPT { return _mm256_andnot_si256( _mm256_and_si256( a, b ), _mm256_set1_epi32( -1 ) ); }
+#endif
+};
+
+// p[ i ] = op( p[ i ], q[ i ] ); q may be equal to p
+
+template<class Op> inline void bit_span_transform( boost::uint64_t* p, boost::uint64_t const* q, std::size_t n, Op op ) BOOST_NOEXCEPT
+{
+    std::size_t i = 0;
+
+#if defined(BOOST_CORE_AVX2)
+
+    for( ; i + 4 <= n; i += 4 )
+    {
+        __m256i const a = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + i ) );
+        __m256i const b = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( q + i ) );
+
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( p + i ), op( a, b ) );
+    }
+
+#elif defined(BOOST_CORE_SSE2)
+
+    for( ; i + 2 <= n; i += 2 )
+    {
+        __m128i const a = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + i ) );
+        __m128i const b = _mm_loadu_si128( reinterpret_cast<__m128i const*>( q + i ) );
+
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( p + i ), op( a, b ) );
+    }
+
+#endif
+
+    for( ; i < n; ++i )
+    {
+        p[ i ] = op( p[ i ], q[ i ] );
+    }
+}
+
+// whether op( p[ i ], q[ i ] ) is nonzero for some i
+
+template<class Op> inline bool bit_span_any( boost::uint64_t const* p, boost::uint64_t const* q, std::size_t n, Op op ) BOOST_NOEXCEPT
+{
+    std::size_t i = 0;
+
+#if defined(BOOST_CORE_AVX2)
+
+    for( ; i + 4 <= n; i += 4 )
+    {
+        __m256i const a = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + i ) );
+        __m256i const b = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( q + i ) );
+
+        __m256i const r = op( a, b );
+
+        if( !_mm256_testz_si256( r, r ) ) return true;
+    }
+
+#elif defined(BOOST_CORE_SSE2)
+
+    for( ; i + 2 <= n; i += 2 )
+    {
+        __m128i const a = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + i ) );
+        __m128i const b = _mm_loadu_si128( reinterpret_cast<__m128i const*>( q + i ) );
+
+        if( _mm_movemask_epi8( _mm_cmpeq_epi8( op( a, b ), _mm_setzero_si128() ) ) != 0xFFFF ) return true;
+    }
+
+#endif
+
+    for( ; i < n; ++i )
+    {
+        if( op( p[ i ], q[ i ] ) != 0 ) return true;
+    }
+
+    return false;
+}
+
+} // namespace detail
+
+// W is boost::uint64_t or boost::uint64_t const
+
+template<class W> class basic_bit_span
+{
+private:
+
+    static_assert( std::is_same<typename std::remove_const<W>::type, boost::uint64_t>::value, "basic_bit_span requires uint64_t words" );
+
+    template<class W2> friend class basic_bit_span;
+
+    W* p_;
+    std::size_t n_;
+
+    template<class W2> void check_size( basic_bit_span<W2> const& rhs ) const BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT( n_ == rhs.n_ );
+        (void)rhs;
+    }
+
+    std::size_t find_from( std::size_t pos ) const BOOST_NOEXCEPT
+    {
+        std::size_t i = pos / 64;
+
+        if( i >= n_ ) return npos;
+
+        boost::uint64_t w = p_[ i ] & ( ~static_cast<boost::uint64_t>( 0 ) << ( pos % 64 ) );
+
+        for( ;; )
+        {
+            if( w != 0 ) return i * 64 + static_cast<std::size_t>( boost::core::countr_zero( w ) );
+            if( ++i == n_ ) return npos;
+
+            w = p_[ i ];
+        }
+    }
+
+public:
+
+    typedef W word_type;
+
+    static BOOST_CONSTEXPR_OR_CONST std::size_t npos = static_cast<std::size_t>( -1 );
+
+    // construction
+
+    BOOST_CONSTEXPR basic_bit_span() BOOST_NOEXCEPT: p_( 0 ), n_( 0 )
+    {
+    }
+
+    template<std::size_t E>
+    BOOST_CONSTEXPR explicit basic_bit_span( span<W, E> words ) BOOST_NOEXCEPT: p_( words.data() ), n_( words.size() )
+    {
+    }
+
+    BOOST_CONSTEXPR basic_bit_span( W* p, std::size_t n ) BOOST_NOEXCEPT: p_( p ), n_( n )
+    {
+    }
+
+    template<class W2, class = typename std::enable_if<std::is_convertible<W2*, W*>::value>::type>
+    BOOST_CONSTEXPR basic_bit_span( basic_bit_span<W2> const& rhs ) BOOST_NOEXCEPT: p_( rhs.p_ ), n_( rhs.n_ )
+    {
+    }
+
+    // observers
+
+    BOOST_CONSTEXPR std::size_t size() const BOOST_NOEXCEPT
+    {
+        return n_ * 64;
+    }
+
+    BOOST_CONSTEXPR bool empty() const BOOST_NOEXCEPT
+    {
+        return n_ == 0;
+    }
+
+    BOOST_CONSTEXPR span<W> words() const BOOST_NOEXCEPT
+    {
+        return span<W>( p_, n_ );
+    }
+
+    bool test( std::size_t pos ) const BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT( pos < size() );
+        return ( p_[ pos / 64 ] >> ( pos % 64 ) ) & 1;
+    }
+
+    bool operator[]( std::size_t pos ) const BOOST_NOEXCEPT
+    {
+        return test( pos );
+    }
+
+    // single bit modifiers
+
+    void set( std::size_t pos ) const BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT( pos < size() );
+        p_[ pos / 64 ] |= static_cast<boost::uint64_t>( 1 ) << ( pos % 64 );
+    }
+
+    void set( std::size_t pos, bool v ) const BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT( pos < size() );
+
+        boost::uint64_t const m = static_cast<boost::uint64_t>( 1 ) << ( pos % 64 );
+        p_[ pos / 64 ] = ( p_[ pos / 64 ] & ~m ) | ( ( static_cast<boost::uint64_t>( 0 ) - v ) & m );
+    }
+
+    void reset( std::size_t pos ) const BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT( pos < size() );
+        p_[ pos / 64 ] &= ~( static_cast<boost::uint64_t>( 1 ) << ( pos % 64 ) );
+    }
+
+    void flip( std::size_t pos ) const BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT( pos < size() );
+        p_[ pos / 64 ] ^= static_cast<boost::uint64_t>( 1 ) << ( pos % 64 );
+    }
+
+    // whole span modifiers
+
+    void set() const BOOST_NOEXCEPT
+    {
+        for( std::size_t i = 0; i < n_; ++i ) p_[ i ] = ~static_cast<boost::uint64_t>( 0 );
+    }
+
+    void reset() const BOOST_NOEXCEPT
+    {
+        for( std::size_t i = 0; i < n_; ++i ) p_[ i ] = 0;
+    }
+
+    void flip() const BOOST_NOEXCEPT
+    {
+        for( std::size_t i = 0; i < n_; ++i ) p_[ i ] = ~p_[ i ];
+    }
+
+    // set operations; rhs must have the same size, and may be
+    // the same span but must not otherwise overlap *this
+
+    template<class W2> basic_bit_span const& operator&=( basic_bit_span<W2> const& rhs ) const BOOST_NOEXCEPT
+    {
+        check_size( rhs );
+        detail::bit_span_transform( p_, rhs.p_, n_, detail::bit_span_and() );
+        return *this;
+    }
+
+    template<class W2> basic_bit_span const& operator|=( basic_bit_span<W2> const& rhs ) const BOOST_NOEXCEPT
+    {
+        check_size( rhs );
+        detail::bit_span_transform( p_, rhs.p_, n_, detail::bit_span_or() );
+        return *this;
+    }
+
+    template<class W2> basic_bit_span const& operator^=( basic_bit_span<W2> const& rhs ) const BOOST_NOEXCEPT
+    {
+        check_size( rhs );
+        detail::bit_span_transform( p_, rhs.p_, n_, detail::bit_span_xor() );
+        return *this;
+    }
+
+    // set difference (AND NOT)
+
+    template<class W2> basic_bit_span const& operator-=( basic_bit_span<W2> const& rhs ) const BOOST_NOEXCEPT
+    {
+        check_size( rhs );
+        detail::bit_span_transform( p_, rhs.p_, n_, detail::bit_span_andnot() );
+        return *this;
+    }
+
+    // copies the bits of rhs into *this
+
+    template<class W2> void assign( basic_bit_span<W2> const& rhs ) const BOOST_NOEXCEPT
+    {
+        check_size( rhs );
+        for( std::size_t i = 0; i < n_; ++i ) p_[ i ] = rhs.p_[ i ];
+    }
+
+    // queries
+
+    std::size_t count() const BOOST_NOEXCEPT
+    {
+        return boost::core::popcount( span<boost::uint64_t const>( p_, n_ ) );
+    }
+
+    bool any() const BOOST_NOEXCEPT
+    {
+        return detail::bit_span_any( p_, p_, n_, detail::bit_span_and() );
+    }
+
+    bool none() const BOOST_NOEXCEPT
+    {
+        return !any();
+    }
+
+    bool all() const BOOST_NOEXCEPT
+    {
+        return !detail::bit_span_any( p_, p_, n_, detail::bit_span_nand() );
+    }
+
+    template<class W2> bool intersects( basic_bit_span<W2> const& rhs ) const BOOST_NOEXCEPT
+    {
+        check_size( rhs );
+
+        return detail::bit_span_any( p_, rhs.p_, n_, detail::bit_span_and() );
+    }
+
+    template<class W2> bool is_subset_of( basic_bit_span<W2> const& rhs ) const BOOST_NOEXCEPT
+    {
+        check_size( rhs );
+
+        return !detail::bit_span_any( p_, rhs.p_, n_, detail::bit_span_andnot() );
+    }
+
+    template<class W2> bool equals( basic_bit_span<W2> const& rhs ) const BOOST_NOEXCEPT
+    {
+        check_size( rhs );
+
+        return !detail::bit_span_any( p_, rhs.p_, n_, detail::bit_span_xor() );
+    }
+
+    // search; the position of the first set bit, or of the first set bit
+    // after pos, or npos
+
+    std::size_t find_first() const BOOST_NOEXCEPT
+    {
+        return find_from( 0 );
+    }
+
+    std::size_t find_next( std::size_t pos ) const BOOST_NOEXCEPT
+    {
+        return pos >= size()? npos: find_from( pos + 1 );
+    }
+
+    // rank; the number of set bits in [0, pos)
+
+    std::size_t rank( std::size_t pos ) const BOOST_NOEXCEPT
+    {
+        BOOST_ASSERT( pos <= size() );
+
+        std::size_t const i = pos / 64;
+        std::size_t r = boost::core::popcount( span<boost::uint64_t const>( p_, i ) );
+
+        if( pos % 64 != 0 )
+        {
+            r += boost::core::popcount( p_[ i ] & ( ~static_cast<boost::uint64_t>( 0 ) >> ( 64 - pos % 64 ) ) );
+        }
+
+        return r;
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class W> BOOST_CONSTEXPR_OR_CONST std::size_t basic_bit_span<W>::npos;
+
+#endif
+
+typedef basic_bit_span<boost::uint64_t> bit_span;
+typedef basic_bit_span<boost::uint64_t const> const_bit_span;
+
+} // namespace core
+} // namespace boost
+
+#endif  // #ifndef BOOST_CORE_BIT_SPAN_HPP_INCLUDED
@@ -9,7 +9,12 @@ Distributed under the Boost Software License, Version 1.0.
 #define BOOST_CORE_DEFAULT_ALLOCATOR_HPP
 
 #include <boost/config.hpp>
+#include <boost/core/allocation_result.hpp>
 #include <new>
+#if defined(BOOST_CORE_USE_MALLOC_USABLE_SIZE) && defined(__GLIBC__)
+#include <malloc.h>
+#define BOOST_CORE_DEFAULT_ALLOCATOR_USABLE_SIZE
+#endif
 
 namespace boost {
 
@@ -112,6 +117,21 @@ struct default_allocator {
     }
 #endif
 
+    allocation_result<T*> allocate_at_least(std::size_t n) {
+        T* p = allocate(n);
+#if defined(BOOST_CORE_DEFAULT_ALLOCATOR_USABLE_SIZE)
+        n = ::malloc_usable_size(p) / sizeof(T);
+#endif
+        allocation_result<T*> result = { p, n };
+        return result;
+    }
+
+#if defined(BOOST_CORE_DEFAULT_ALLOCATOR_USABLE_SIZE)
+    bool expand(T* p, std::size_t, std::size_t m) BOOST_NOEXCEPT {
+        return m <= max_size() && ::malloc_usable_size(p) >= sizeof(T) * m;
+    }
+#endif
+
 #if defined(BOOST_NO_CXX11_ALLOCATOR)
     T* allocate(std::size_t n, const void*) {
         return allocate(n);
@@ -155,4 +175,6 @@ using default_::default_allocator;
 
 } /* boost */
 
+#undef BOOST_CORE_DEFAULT_ALLOCATOR_USABLE_SIZE
+
 #endif
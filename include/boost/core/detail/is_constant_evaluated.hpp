@@ -0,0 +1,65 @@
+#ifndef BOOST_CORE_DETAIL_IS_CONSTANT_EVALUATED_HPP_INCLUDED
+#define BOOST_CORE_DETAIL_IS_CONSTANT_EVALUATED_HPP_INCLUDED
+
+// MS compatible compilers support #pragma once
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+// boost::core::detail::is_constant_evaluated()
+//
+// Returns true during constant evaluation, false otherwise.
+// Used to select a runtime-only (intrinsic or SIMD) code path
+// inside a constexpr function.
+//
+// When the compiler provides no way to tell, returns false in
+// a context that is never constant evaluated (pre-C++14), and
+// BOOST_CORE_HAS_BUILTIN_IS_CONSTANT_EVALUATED is left undefined
+// so that callers can keep the portable constexpr path.
+//
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/config.hpp>
+
+#if defined(__has_builtin)
+# if __has_builtin(__builtin_is_constant_evaluated)
+#  define BOOST_CORE_HAS_BUILTIN_IS_CONSTANT_EVALUATED
+# endif
+#endif
+
+#if !defined(BOOST_CORE_HAS_BUILTIN_IS_CONSTANT_EVALUATED)
+# if defined(BOOST_GCC) && BOOST_GCC >= 90000
+#  define BOOST_CORE_HAS_BUILTIN_IS_CONSTANT_EVALUATED
+# elif defined(BOOST_MSVC) && BOOST_MSVC >= 1925
+#  define BOOST_CORE_HAS_BUILTIN_IS_CONSTANT_EVALUATED
+# endif
+#endif
+
+namespace boost
+{
+namespace core
+{
+namespace detail
+{
+
+BOOST_CONSTEXPR inline bool is_constant_evaluated() BOOST_NOEXCEPT
+{
+#if defined(BOOST_CORE_HAS_BUILTIN_IS_CONSTANT_EVALUATED)
+
+    return __builtin_is_constant_evaluated();
+
+#else
+
+    return false;
+
+#endif
+}
+
+} // namespace detail
+} // namespace core
+} // namespace boost
+
+#endif // #ifndef BOOST_CORE_DETAIL_IS_CONSTANT_EVALUATED_HPP_INCLUDED
@@ -0,0 +1,62 @@
+#ifndef BOOST_CORE_DETAIL_SIMD_HPP_INCLUDED
+#define BOOST_CORE_DETAIL_SIMD_HPP_INCLUDED
+
+// MS compatible compilers support #pragma once
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+// Detection of the SIMD instruction sets enabled for the
+// current compilation target.
+//
+// Defines BOOST_CORE_SSE2, BOOST_CORE_SSSE3, BOOST_CORE_AVX2,
+// BOOST_CORE_AVX512VPOPCNTDQ and BOOST_CORE_BMI2 when the corresponding
+// instructions can be used unconditionally,
+// and includes the matching intrinsics header. No runtime dispatch
+// is performed; the code paths follow the compiler options
+// (e.g. -msse4.2, -mavx2, /arch:AVX2).
+//
+// Define BOOST_CORE_NO_SIMD to disable all SIMD code paths.
+//
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/config.hpp>
+
+#if !defined(BOOST_CORE_NO_SIMD)
+
+#if defined(__SSE2__) || defined(_M_X64) || ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 )
+# define BOOST_CORE_SSE2
+#endif
+
+#if defined(BOOST_CORE_SSE2) && ( defined(__SSSE3__) || defined(__AVX__) )
+# define BOOST_CORE_SSSE3
+#endif
+
+#if defined(BOOST_CORE_SSSE3) && defined(__AVX2__)
+# define BOOST_CORE_AVX2
+#endif
+
+#if defined(BOOST_CORE_AVX2) && defined(__AVX512F__) && defined(__AVX512VPOPCNTDQ__)
+# define BOOST_CORE_AVX512VPOPCNTDQ
+#endif
+
+// MSVC has no separate BMI2 option; /arch:AVX2 implies it
+
+#if defined(__BMI2__) || ( defined(_MSC_VER) && !defined(__clang__) && defined(__AVX2__) )
+# define BOOST_CORE_BMI2
+#endif
+
+#endif // !defined(BOOST_CORE_NO_SIMD)
+
+#if defined(BOOST_CORE_AVX2) || defined(BOOST_CORE_BMI2)
+# include <immintrin.h>
+#elif defined(BOOST_CORE_SSSE3)
+# include <tmmintrin.h>
+#elif defined(BOOST_CORE_SSE2)
+# include <emmintrin.h>
+#endif
+
+#endif // #ifndef BOOST_CORE_DETAIL_SIMD_HPP_INCLUDED
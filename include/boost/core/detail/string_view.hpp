@@ -15,10 +15,14 @@
 
 #include <boost/core/enable_if.hpp>
 #include <boost/core/is_same.hpp>
+#include <boost/core/bit.hpp>
+#include <boost/core/detail/is_constant_evaluated.hpp>
+#include <boost/core/detail/simd.hpp>
 #include <boost/assert.hpp>
 #include <boost/assert/source_location.hpp>
 #include <boost/throw_exception.hpp>
 #include <boost/config.hpp>
+#include <boost/cstdint.hpp>
 #include <string>
 #include <algorithm>
 #include <utility>
@@ -35,6 +39,14 @@
 # include <type_traits>
 #endif
 
+// The SIMD code paths are only taken at runtime, so they are enabled
+// only when constant evaluation can be detected, or when the functions
+// using them are not constexpr anyway
+
+#if defined(BOOST_CORE_SSE2) && ( defined(BOOST_CORE_HAS_BUILTIN_IS_CONSTANT_EVALUATED) || defined(BOOST_NO_CXX14_CONSTEXPR) )
+# define BOOST_CORE_SV_SIMD
+#endif
+
 namespace boost
 {
 
@@ -59,6 +71,128 @@ template<> struct sv_to_uchar<char>
     typedef unsigned char type;
 };
 
+// char_traits<Ch>::length is only constexpr in C++17; count the
+// characters during constant evaluation so that string_view can be
+// constructed from a literal in a C++14 constant expression
+
+template<class Ch> BOOST_CXX14_CONSTEXPR std::size_t sv_length( Ch const* s ) BOOST_NOEXCEPT
+{
+#if defined(BOOST_CORE_HAS_BUILTIN_IS_CONSTANT_EVALUATED) && !defined(BOOST_NO_CXX14_CONSTEXPR)
+
+    if( detail::is_constant_evaluated() )
+    {
+        std::size_t n = 0;
+        while( s[ n ] != Ch() ) ++n;
+        return n;
+    }
+
+#endif
+
+    return std::char_traits<Ch>::length( s );
+}
+
+// find( Ch const* s, size_type pos, size_type n ), requires n > 1
+
+template<class Ch> BOOST_CXX14_CONSTEXPR std::size_t find_scalar( Ch const* p_, std::size_t n_, Ch const* s, std::size_t pos, std::size_t n ) BOOST_NOEXCEPT
+{
+    if( pos + n > n_ ) return static_cast<std::size_t>( -1 );
+
+    Ch const* p = p_ + pos;
+    Ch const* last = p_ + n_ - n + 1;
+
+    for( ;; )
+    {
+        p = std::char_traits<Ch>::find( p, last - p, s[0] );
+
+        if( p == 0 ) break;
+
+        if( std::char_traits<Ch>::compare( p + 1, s + 1, n - 1 ) == 0 ) return p - p_;
+
+        ++p;
+    }
+
+    return static_cast<std::size_t>( -1 );
+}
+
+template<class Ch> BOOST_CXX14_CONSTEXPR std::size_t find( Ch const* p_, std::size_t n_, Ch const* s, std::size_t pos, std::size_t n ) BOOST_NOEXCEPT
+{
+    return detail::find_scalar( p_, n_, s, pos, n );
+}
+
+#if defined(BOOST_CORE_SV_SIMD)
+
+// Compares a block of haystack positions against both the first and the
+// last character of the needle at once, and only calls memcmp for the
+// positions where both match. This avoids the pathological behavior of
+// the scalar loop when the first character of the needle is frequent.
+
+inline std::size_t find_simd( char const* p_, std::size_t n_, char const* s, std::size_t pos, std::size_t n ) BOOST_NOEXCEPT
+{
+    std::size_t i = pos;
+
+#if defined(BOOST_CORE_AVX2)
+
+    {
+        __m256i const first = _mm256_set1_epi8( s[ 0 ] );
+        __m256i const last = _mm256_set1_epi8( s[ n - 1 ] );
+
+        for( ; i + n - 1 + 32 <= n_; i += 32 )
+        {
+            __m256i const b1 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p_ + i ) );
+            __m256i const b2 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p_ + i + n - 1 ) );
+
+            boost::uint32_t mask = static_cast<boost::uint32_t>( _mm256_movemask_epi8( _mm256_and_si256( _mm256_cmpeq_epi8( b1, first ), _mm256_cmpeq_epi8( b2, last ) ) ) );
+
+            while( mask != 0 )
+            {
+                std::size_t const j = i + boost::core::countr_zero( mask );
+
+                if( std::memcmp( p_ + j + 1, s + 1, n - 2 ) == 0 ) return j;
+
+                mask &= mask - 1;
+            }
+        }
+    }
+
+#endif
+
+    {
+        __m128i const first = _mm_set1_epi8( s[ 0 ] );
+        __m128i const last = _mm_set1_epi8( s[ n - 1 ] );
+
+        for( ; i + n - 1 + 16 <= n_; i += 16 )
+        {
+            __m128i const b1 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p_ + i ) );
+            __m128i const b2 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p_ + i + n - 1 ) );
+
+            boost::uint32_t mask = static_cast<boost::uint32_t>( _mm_movemask_epi8( _mm_and_si128( _mm_cmpeq_epi8( b1, first ), _mm_cmpeq_epi8( b2, last ) ) ) );
+
+            while( mask != 0 )
+            {
+                std::size_t const j = i + boost::core::countr_zero( mask );
+
+                if( std::memcmp( p_ + j + 1, s + 1, n - 2 ) == 0 ) return j;
+
+                mask &= mask - 1;
+            }
+        }
+    }
+
+    return detail::find_scalar( p_, n_, s, i, n );
+}
+
+BOOST_CXX14_CONSTEXPR inline std::size_t find( char const* p_, std::size_t n_, char const* s, std::size_t pos, std::size_t n ) BOOST_NOEXCEPT
+{
+    if( !detail::is_constant_evaluated() )
+    {
+        return detail::find_simd( p_, n_, s, pos, n );
+    }
+
+    return detail::find_scalar( p_, n_, s, pos, n );
+}
+
+#endif // #if defined(BOOST_CORE_SV_SIMD)
+
 #if defined(__GNUC__) && __GNUC__ * 100 + __GNUC_MINOR__ >= 406
 # pragma GCC diagnostic push
 # pragma GCC diagnostic ignored "-Wtype-limits"
@@ -330,12 +464,346 @@ template<class Ch> BOOST_CXX14_CONSTEXPR std::size_t find_last_not_of( Ch const*
     return npos;
 }
 
+// Character set membership via two 16-entry tables indexed by the low and
+// the high nibble of a byte, as used by PSHUFB: the high nibbles whose
+// columns (sets of low nibbles) are identical share one of eight buckets,
+// hi[ h ] holds the bucket bit of column h, and lo[ l ] holds the bits of
+// all buckets that contain l. A byte x is in the set iff
+// lo[ x & 15 ] & hi[ x >> 4 ] is nonzero.
+
+struct sv_nibble_table
+{
+    unsigned char lo[ 16 ];
+    unsigned char hi[ 16 ];
+
+    // returns false when the set needs more than eight buckets
+    BOOST_CXX14_CONSTEXPR bool init( char const* s, std::size_t n ) BOOST_NOEXCEPT
+    {
+        boost::uint16_t col[ 16 ] = {};
+
+        for( std::size_t j = 0; j < n; ++j )
+        {
+            unsigned char ch = static_cast<unsigned char>( s[ j ] );
+            col[ ch >> 4 ] = static_cast<boost::uint16_t>( col[ ch >> 4 ] | 1u << ( ch & 15 ) );
+        }
+
+        boost::uint16_t bucket[ 8 ] = {};
+        int k = 0;
+
+        for( int h = 0; h < 16; ++h )
+        {
+            hi[ h ] = 0;
+
+            if( col[ h ] == 0 ) continue;
+
+            int b = 0;
+
+            while( b < k && bucket[ b ] != col[ h ] ) ++b;
+
+            if( b == k )
+            {
+                if( k == 8 ) return false;
+                bucket[ k++ ] = col[ h ];
+            }
+
+            hi[ h ] = static_cast<unsigned char>( 1u << b );
+        }
+
+        for( int l = 0; l < 16; ++l )
+        {
+            unsigned m = 0;
+
+            for( int b = 0; b < k; ++b )
+            {
+                if( bucket[ b ] & ( 1u << l ) ) m |= 1u << b;
+            }
+
+            lo[ l ] = static_cast<unsigned char>( m );
+        }
+
+        return true;
+    }
+};
+
+#if defined(BOOST_CORE_SV_SIMD) && defined(BOOST_CORE_SSSE3)
+
+// Returns the mask of the bytes of x that are in the set
+inline boost::uint32_t sv_classify( __m128i x, __m128i lo, __m128i hi ) BOOST_NOEXCEPT
+{
+    __m128i const m0f = _mm_set1_epi8( 0x0F );
+
+    __m128i const r = _mm_and_si128(
+        _mm_shuffle_epi8( lo, _mm_and_si128( x, m0f ) ),
+        _mm_shuffle_epi8( hi, _mm_and_si128( _mm_srli_epi16( x, 4 ), m0f ) ) );
+
+    return static_cast<boost::uint32_t>( _mm_movemask_epi8( _mm_cmpeq_epi8( r, _mm_setzero_si128() ) ) ) ^ 0xFFFFu;
+}
+
+// Requires n_ - pos >= 16; when `negate` is set, finds the first
+// character that is not in the set
+inline std::size_t find_first_of_simd( char const* p_, std::size_t n_, std::size_t pos, sv_nibble_table const& t, bool negate ) BOOST_NOEXCEPT
+{
+    std::size_t i = pos;
+
+    __m128i const lo = _mm_loadu_si128( reinterpret_cast<__m128i const*>( t.lo ) );
+    __m128i const hi = _mm_loadu_si128( reinterpret_cast<__m128i const*>( t.hi ) );
+
+#if defined(BOOST_CORE_AVX2)
+
+    {
+        __m256i const lo2 = _mm256_broadcastsi128_si256( lo );
+        __m256i const hi2 = _mm256_broadcastsi128_si256( hi );
+        __m256i const m0f = _mm256_set1_epi8( 0x0F );
+
+        boost::uint32_t const flip = negate? 0: 0xFFFFFFFFu;
+
+        for( ; i + 32 <= n_; i += 32 )
+        {
+            __m256i const x = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p_ + i ) );
+
+            __m256i const r = _mm256_and_si256(
+                _mm256_shuffle_epi8( lo2, _mm256_and_si256( x, m0f ) ),
+                _mm256_shuffle_epi8( hi2, _mm256_and_si256( _mm256_srli_epi16( x, 4 ), m0f ) ) );
+
+            boost::uint32_t const mask = static_cast<boost::uint32_t>( _mm256_movemask_epi8( _mm256_cmpeq_epi8( r, _mm256_setzero_si256() ) ) ) ^ flip;
+
+            if( mask != 0 ) return i + boost::core::countr_zero( mask );
+        }
+    }
+
+#endif
+
+    boost::uint32_t const flip = negate? 0xFFFFu: 0;
+
+    for( ; i + 16 <= n_; i += 16 )
+    {
+        __m128i const x = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p_ + i ) );
+
+        boost::uint32_t const mask = detail::sv_classify( x, lo, hi ) ^ flip;
+
+        if( mask != 0 ) return i + boost::core::countr_zero( mask );
+    }
+
+    if( i < n_ )
+    {
+        // the last 16 characters, overlapping the ones already checked
+
+        std::size_t const j = n_ - 16;
+
+        __m128i const x = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p_ + j ) );
+
+        boost::uint32_t mask = detail::sv_classify( x, lo, hi ) ^ flip;
+
+        mask &= ~( ( 1u << ( i - j ) ) - 1 );
+
+        if( mask != 0 ) return j + boost::core::countr_zero( mask );
+    }
+
+    return static_cast<std::size_t>( -1 );
+}
+
+BOOST_CXX14_CONSTEXPR inline std::size_t find_first_of( char const* p_, std::size_t n_, char const* s, std::size_t pos, std::size_t n ) BOOST_NOEXCEPT
+{
+    if( !detail::is_constant_evaluated() && n_ - pos >= 16 )
+    {
+        sv_nibble_table t = {};
+
+        if( t.init( s, n ) )
+        {
+            return detail::find_first_of_simd( p_, n_, pos, t, false );
+        }
+    }
+
+    return detail::find_first_of<char>( p_, n_, s, pos, n );
+}
+
+BOOST_CXX14_CONSTEXPR inline std::size_t find_first_not_of( char const* p_, std::size_t n_, char const* s, std::size_t pos, std::size_t n ) BOOST_NOEXCEPT
+{
+    if( !detail::is_constant_evaluated() && n_ - pos >= 16 )
+    {
+        sv_nibble_table t = {};
+
+        if( t.init( s, n ) )
+        {
+            return detail::find_first_of_simd( p_, n_, pos, t, true );
+        }
+    }
+
+    return detail::find_first_not_of<char>( p_, n_, s, pos, n );
+}
+
+#endif // #if defined(BOOST_CORE_SV_SIMD) && defined(BOOST_CORE_SSSE3)
+
 #if defined(__GNUC__) && __GNUC__ * 100 + __GNUC_MINOR__ >= 406
 # pragma GCC diagnostic pop
 #endif
 
 } // namespace detail
 
+// char_set
+
+class char_set
+{
+private:
+
+    boost::uint64_t bits_[ 4 ];
+
+    detail::sv_nibble_table nt_;
+    bool nt_valid_;
+
+public:
+
+    BOOST_CONSTEXPR char_set() BOOST_NOEXCEPT: bits_(), nt_(), nt_valid_( true )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR char_set( char const* s, std::size_t n ) BOOST_NOEXCEPT: bits_(), nt_(), nt_valid_( false )
+    {
+        init( s, n );
+    }
+
+    BOOST_CXX14_CONSTEXPR char_set( char const* s ) BOOST_NOEXCEPT: bits_(), nt_(), nt_valid_( false )
+    {
+        std::size_t n = 0;
+        while( s[ n ] != 0 ) ++n;
+
+        init( s, n );
+    }
+
+private:
+
+    BOOST_CXX14_CONSTEXPR void init( char const* s, std::size_t n ) BOOST_NOEXCEPT
+    {
+        for( std::size_t j = 0; j < n; ++j )
+        {
+            unsigned char ch = static_cast<unsigned char>( s[ j ] );
+            bits_[ ch >> 6 ] |= boost::uint64_t( 1 ) << ( ch & 63 );
+        }
+
+        nt_valid_ = nt_.init( s, n );
+    }
+
+public:
+
+    template<class Ch> BOOST_CXX14_CONSTEXPR bool contains( Ch c ) const BOOST_NOEXCEPT
+    {
+        boost::ulong_long_type ch = static_cast<typename detail::sv_to_uchar<Ch>::type>( c );
+        return ch < 256 && ( ( bits_[ ch >> 6 ] >> ( ch & 63 ) ) & 1 ) != 0;
+    }
+
+    BOOST_CXX14_CONSTEXPR std::size_t size() const BOOST_NOEXCEPT
+    {
+        return static_cast<std::size_t>( boost::core::popcount( bits_[ 0 ] ) + boost::core::popcount( bits_[ 1 ] ) + boost::core::popcount( bits_[ 2 ] ) + boost::core::popcount( bits_[ 3 ] ) );
+    }
+
+    BOOST_CONSTEXPR bool empty() const BOOST_NOEXCEPT
+    {
+        return ( bits_[ 0 ] | bits_[ 1 ] | bits_[ 2 ] | bits_[ 3 ] ) == 0;
+    }
+
+    // nibble tables for the SIMD classifier, or 0 if the set
+    // cannot be represented by them
+    BOOST_CONSTEXPR detail::sv_nibble_table const* nibble_table() const BOOST_NOEXCEPT
+    {
+        return nt_valid_? &nt_: 0;
+    }
+};
+
+namespace detail
+{
+
+// the first position i >= pos with cs.contains( p_[ i ] ) != negate
+
+template<class Ch> BOOST_CXX14_CONSTEXPR std::size_t find_first_of( Ch const* p_, std::size_t n_, char_set const& cs, std::size_t pos, bool negate ) BOOST_NOEXCEPT
+{
+    for( std::size_t i = pos; i < n_; ++i )
+    {
+        if( cs.contains( p_[ i ] ) != negate ) return i;
+    }
+
+    return static_cast<std::size_t>( -1 );
+}
+
+// the last position i <= pos with cs.contains( p_[ i ] ) != negate
+
+template<class Ch> BOOST_CXX14_CONSTEXPR std::size_t find_last_of( Ch const* p_, char_set const& cs, std::size_t pos, bool negate ) BOOST_NOEXCEPT
+{
+    std::size_t const npos = static_cast< std::size_t >( -1 );
+
+    std::size_t i = pos;
+
+    do
+    {
+        if( cs.contains( p_[ i ] ) != negate ) return i;
+        --i;
+    }
+    while( i != npos );
+
+    return npos;
+}
+
+#if defined(BOOST_CORE_SV_SIMD) && defined(BOOST_CORE_SSSE3)
+
+// Requires pos >= 15
+inline std::size_t find_last_of_simd( char const* p_, std::size_t pos, sv_nibble_table const& t, bool negate ) BOOST_NOEXCEPT
+{
+    __m128i const lo = _mm_loadu_si128( reinterpret_cast<__m128i const*>( t.lo ) );
+    __m128i const hi = _mm_loadu_si128( reinterpret_cast<__m128i const*>( t.hi ) );
+
+    boost::uint32_t const flip = negate? 0xFFFFu: 0;
+
+    // i is the number of characters left to check
+    std::size_t i = pos + 1;
+
+    for( ; i >= 16; i -= 16 )
+    {
+        __m128i const x = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p_ + i - 16 ) );
+
+        boost::uint32_t const mask = detail::sv_classify( x, lo, hi ) ^ flip;
+
+        if( mask != 0 ) return i - 16 + 31 - boost::core::countl_zero( mask );
+    }
+
+    if( i > 0 )
+    {
+        // the first 16 characters, overlapping the ones already checked
+
+        __m128i const x = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p_ ) );
+
+        boost::uint32_t mask = detail::sv_classify( x, lo, hi ) ^ flip;
+
+        mask &= ( 1u << i ) - 1;
+
+        if( mask != 0 ) return 31 - boost::core::countl_zero( mask );
+    }
+
+    return static_cast<std::size_t>( -1 );
+}
+
+BOOST_CXX14_CONSTEXPR inline std::size_t find_first_of( char const* p_, std::size_t n_, char_set const& cs, std::size_t pos, bool negate ) BOOST_NOEXCEPT
+{
+    if( !detail::is_constant_evaluated() && n_ - pos >= 16 && cs.nibble_table() )
+    {
+        return detail::find_first_of_simd( p_, n_, pos, *cs.nibble_table(), negate );
+    }
+
+    return detail::find_first_of<char>( p_, n_, cs, pos, negate );
+}
+
+BOOST_CXX14_CONSTEXPR inline std::size_t find_last_of( char const* p_, char_set const& cs, std::size_t pos, bool negate ) BOOST_NOEXCEPT
+{
+    if( !detail::is_constant_evaluated() && pos >= 15 && cs.nibble_table() )
+    {
+        return detail::find_last_of_simd( p_, pos, *cs.nibble_table(), negate );
+    }
+
+    return detail::find_last_of<char>( p_, cs, pos, negate );
+}
+
+#endif // #if defined(BOOST_CORE_SV_SIMD) && defined(BOOST_CORE_SSSE3)
+
+} // namespace detail
+
 template<class Ch> class basic_string_view
 {
 private:
@@ -372,7 +840,7 @@ public:
     {
     }
 
-    BOOST_CONSTEXPR basic_string_view( Ch const* str ) BOOST_NOEXCEPT: p_( str ), n_( traits_type::length( str ) )
+    BOOST_CONSTEXPR basic_string_view( Ch const* str ) BOOST_NOEXCEPT: p_( str ), n_( detail::sv_length( str ) )
     {
     }
 
@@ -675,26 +1143,12 @@ public:
         if( pos + n > size() ) return npos;
         if( n == 0 ) return pos;
 
-        Ch const* p = data() + pos;
-        Ch const* last = data() + size() - n + 1;
-
-        for( ;; )
-        {
-            p = traits_type::find( p, last - p, s[0] );
-
-            if( p == 0 ) break;
-
-            if( traits_type::compare( p + 1, s + 1, n - 1 ) == 0 ) return p - data();
-
-            ++p;
-        }
-
-        return npos;
+        return detail::find( data(), size(), s, pos, n );
     }
 
     BOOST_CONSTEXPR size_type find( Ch const* s, size_type pos = 0 ) const BOOST_NOEXCEPT
     {
-        return find( s, pos, traits_type::length( s ) );
+        return find( s, pos, detail::sv_length( s ) );
     }
 
     // rfind
@@ -755,7 +1209,7 @@ public:
 
     BOOST_CONSTEXPR size_type rfind( Ch const* s, size_type pos = npos ) const BOOST_NOEXCEPT
     {
-        return rfind( s, pos, traits_type::length( s ) );
+        return rfind( s, pos, detail::sv_length( s ) );
     }
 
     // find_first_of
@@ -780,7 +1234,14 @@ public:
 
     BOOST_CXX14_CONSTEXPR size_type find_first_of( Ch const* s, size_type pos = 0 ) const BOOST_NOEXCEPT
     {
-        return find_first_of( s, pos, traits_type::length( s ) );
+        return find_first_of( s, pos, detail::sv_length( s ) );
+    }
+
+    BOOST_CXX14_CONSTEXPR size_type find_first_of( char_set const& cs, size_type pos = 0 ) const BOOST_NOEXCEPT
+    {
+        if( pos >= size() ) return npos;
+
+        return detail::find_first_of( data(), size(), cs, pos, false );
     }
 
     // find_last_of
@@ -819,7 +1280,24 @@ public:
 
     BOOST_CXX14_CONSTEXPR size_type find_last_of( Ch const* s, size_type pos = npos ) const BOOST_NOEXCEPT
     {
-        return find_last_of( s, pos, traits_type::length( s ) );
+        return find_last_of( s, pos, detail::sv_length( s ) );
+    }
+
+    BOOST_CXX14_CONSTEXPR size_type find_last_of( char_set const& cs, size_type pos = npos ) const BOOST_NOEXCEPT
+    {
+        size_type m = size();
+
+        if( m == 0 )
+        {
+            return npos;
+        }
+
+        if( pos > m - 1 )
+        {
+            pos = m - 1;
+        }
+
+        return detail::find_last_of( data(), cs, pos, false );
     }
 
     // find_first_not_of
@@ -849,7 +1327,14 @@ public:
 
     BOOST_CXX14_CONSTEXPR size_type find_first_not_of( Ch const* s, size_type pos = 0 ) const BOOST_NOEXCEPT
     {
-        return find_first_not_of( s, pos, traits_type::length( s ) );
+        return find_first_not_of( s, pos, detail::sv_length( s ) );
+    }
+
+    BOOST_CXX14_CONSTEXPR size_type find_first_not_of( char_set const& cs, size_type pos = 0 ) const BOOST_NOEXCEPT
+    {
+        if( pos >= size() ) return npos;
+
+        return detail::find_first_of( data(), size(), cs, pos, true );
     }
 
     // find_last_not_of
@@ -907,7 +1392,24 @@ public:
 
     BOOST_CXX14_CONSTEXPR size_type find_last_not_of( Ch const* s, size_type pos = npos ) const BOOST_NOEXCEPT
     {
-        return find_last_not_of( s, pos, traits_type::length( s ) );
+        return find_last_not_of( s, pos, detail::sv_length( s ) );
+    }
+
+    BOOST_CXX14_CONSTEXPR size_type find_last_not_of( char_set const& cs, size_type pos = npos ) const BOOST_NOEXCEPT
+    {
+        size_type m = size();
+
+        if( m == 0 )
+        {
+            return npos;
+        }
+
+        if( pos > m - 1 )
+        {
+            pos = m - 1;
+        }
+
+        return detail::find_last_of( data(), cs, pos, true );
     }
 
     // contains
@@ -0,0 +1,346 @@
+/*
+Copyright 2026
+
+Distributed under the Boost Software License, Version 1.0.
+(http://www.boost.org/LICENSE_1_0.txt)
+*/
+#ifndef BOOST_CORE_HUGEPAGE_ALLOCATOR_HPP
+#define BOOST_CORE_HUGEPAGE_ALLOCATOR_HPP
+
+#include <boost/config.hpp>
+#include <boost/core/allocation_result.hpp>
+#include <boost/static_assert.hpp>
+#include <cstddef>
+#include <new>
+#if !defined(BOOST_NO_CXX11_HDR_TYPE_TRAITS)
+#include <type_traits>
+#endif
+#if defined(__linux__)
+#include <sys/mman.h>
+#if defined(MADV_HUGEPAGE) && defined(MAP_ANONYMOUS)
+#define BOOST_CORE_HUGEPAGE_ALLOCATOR_MMAP
+#endif
+#endif
+
+namespace boost {
+
+#if defined(BOOST_NO_EXCEPTIONS)
+BOOST_NORETURN void throw_exception(const std::exception&);
+#endif
+
+namespace detail {
+
+template<class T>
+struct hp_align_of {
+    struct type {
+        char c;
+        T t;
+    };
+
+    static const std::size_t value = sizeof(type) - sizeof(T);
+};
+
+template<class T>
+const std::size_t hp_align_of<T>::value;
+
+union hp_max_align {
+    long double ld;
+    long l;
+    double d;
+    void* p;
+    void (*f)();
+};
+
+template<class T, std::size_t N>
+struct hp_alignment {
+    static const std::size_t value = N > hp_align_of<T>::value ? N :
+        hp_align_of<T>::value;
+};
+
+template<class T, std::size_t N>
+const std::size_t hp_alignment<T, N>::value;
+
+/*
+Requests of at least hp_size bytes are mapped directly, rounded up to a
+multiple of hp_size and aligned to it, so that the kernel can back them
+with transparent huge pages.
+*/
+enum {
+    hp_size = 2097152
+};
+
+BOOST_NORETURN inline void
+hp_bad_alloc()
+{
+#if !defined(BOOST_NO_EXCEPTIONS)
+    throw std::bad_alloc();
+#else
+    boost::throw_exception(std::bad_alloc());
+#endif
+}
+
+inline std::size_t
+hp_round(std::size_t n) BOOST_NOEXCEPT
+{
+    return (n + (hp_size - 1)) & ~static_cast<std::size_t>(hp_size - 1);
+}
+
+inline bool
+hp_mapped(std::size_t n) BOOST_NOEXCEPT
+{
+#if defined(BOOST_CORE_HUGEPAGE_ALLOCATOR_MMAP)
+    return n >= hp_size;
+#else
+    (void)n;
+    return false;
+#endif
+}
+
+#if defined(BOOST_CORE_HUGEPAGE_ALLOCATOR_MMAP)
+inline void*
+hp_map(std::size_t n, std::size_t a)
+{
+    const std::size_t b = a > hp_size ? a :
+        static_cast<std::size_t>(hp_size);
+    if (n > static_cast<std::size_t>(-1) - b - b) {
+        detail::hp_bad_alloc();
+    }
+    const std::size_t s = detail::hp_round(n);
+    void* p = ::mmap(0, s + b, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) {
+        detail::hp_bad_alloc();
+    }
+    char* c = static_cast<char*>(p);
+    char* r = c + ((b - reinterpret_cast<std::size_t>(c) % b) % b);
+    if (r != c) {
+        ::munmap(c, r - c);
+    }
+    if (r + s != c + s + b) {
+        ::munmap(r + s, (c + s + b) - (r + s));
+    }
+    ::madvise(r, s, MADV_HUGEPAGE);
+    return r;
+}
+#endif
+
+inline void*
+hp_operator_new(std::size_t n)
+{
+#if !defined(BOOST_NO_EXCEPTIONS)
+    return ::operator new(n);
+#else
+    void* p = ::operator new(n, std::nothrow);
+    if (!p) {
+        detail::hp_bad_alloc();
+    }
+    return p;
+#endif
+}
+
+inline void
+hp_operator_delete(void* p) BOOST_NOEXCEPT
+{
+#if !defined(BOOST_NO_EXCEPTIONS)
+    ::operator delete(p);
+#else
+    ::operator delete(p, std::nothrow);
+#endif
+}
+
+inline void*
+hp_allocate(std::size_t n, std::size_t a)
+{
+#if defined(BOOST_CORE_HUGEPAGE_ALLOCATOR_MMAP)
+    if (detail::hp_mapped(n)) {
+        return detail::hp_map(n, a);
+    }
+#endif
+#if defined(__cpp_aligned_new)
+    if (a > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+#if !defined(BOOST_NO_EXCEPTIONS)
+        return ::operator new(n, std::align_val_t(a));
+#else
+        void* p = ::operator new(n, std::align_val_t(a), std::nothrow);
+        if (!p) {
+            detail::hp_bad_alloc();
+        }
+        return p;
+#endif
+    }
+#else
+    if (a > hp_align_of<hp_max_align>::value) {
+        char* p = static_cast<char*>(detail::hp_operator_new(n + a));
+        char* r = p + (a - reinterpret_cast<std::size_t>(p) % a);
+        reinterpret_cast<char**>(r)[-1] = p;
+        return r;
+    }
+#endif
+    return detail::hp_operator_new(n);
+}
+
+inline bool
+hp_expand(void* p, std::size_t n, std::size_t m) BOOST_NOEXCEPT
+{
+#if defined(BOOST_CORE_HUGEPAGE_ALLOCATOR_MMAP)
+    if (detail::hp_mapped(n)) {
+        const std::size_t s = detail::hp_round(n);
+        const std::size_t t = detail::hp_round(m);
+        if (t < m) {
+            return false;
+        }
+        if (t == s) {
+            return true;
+        }
+#if defined(MREMAP_MAYMOVE)
+        /* without MREMAP_MAYMOVE the mapping only grows in place */
+        if (::mremap(p, s, t, 0) != MAP_FAILED) {
+            ::madvise(static_cast<char*>(p) + s, t - s, MADV_HUGEPAGE);
+            return true;
+        }
+#else
+        (void)p;
+#endif
+    }
+#else
+    (void)p;
+    (void)n;
+    (void)m;
+#endif
+    return false;
+}
+
+inline void
+hp_deallocate(void* p, std::size_t n, std::size_t a) BOOST_NOEXCEPT
+{
+#if defined(BOOST_CORE_HUGEPAGE_ALLOCATOR_MMAP)
+    if (detail::hp_mapped(n)) {
+        ::munmap(p, detail::hp_round(n));
+        return;
+    }
+#endif
+#if defined(__cpp_aligned_new)
+    if (a > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+#if !defined(BOOST_NO_EXCEPTIONS)
+        ::operator delete(p, std::align_val_t(a));
+#else
+        ::operator delete(p, std::align_val_t(a), std::nothrow);
+#endif
+        return;
+    }
+#else
+    if (a > hp_align_of<hp_max_align>::value) {
+        detail::hp_operator_delete(static_cast<char**>(p)[-1]);
+        return;
+    }
+#endif
+    detail::hp_operator_delete(p);
+}
+
+} /* detail */
+
+template<class T, std::size_t Alignment = 0>
+struct hugepage_allocator {
+    BOOST_STATIC_ASSERT((Alignment & (Alignment - 1)) == 0);
+
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+#if defined(BOOST_NO_CXX11_ALLOCATOR)
+    typedef T& reference;
+    typedef const T& const_reference;
+#endif
+#if !defined(BOOST_NO_CXX11_HDR_TYPE_TRAITS)
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type is_always_equal;
+#endif
+
+    template<class U>
+    struct rebind {
+        typedef hugepage_allocator<U, Alignment> other;
+    };
+
+#if !defined(BOOST_NO_CXX11_DEFAULTED_FUNCTIONS)
+    hugepage_allocator() = default;
+#else
+    BOOST_CONSTEXPR hugepage_allocator() BOOST_NOEXCEPT { }
+#endif
+
+    template<class U>
+    BOOST_CONSTEXPR hugepage_allocator(const hugepage_allocator<U,
+        Alignment>&) BOOST_NOEXCEPT { }
+
+    BOOST_CONSTEXPR std::size_t max_size() const BOOST_NOEXCEPT {
+        return (static_cast<std::size_t>(-1) / 2 -
+            detail::hp_alignment<T, Alignment>::value) / sizeof(T);
+    }
+
+    T* allocate(std::size_t n) {
+        if (n > max_size()) {
+            detail::hp_bad_alloc();
+        }
+        return static_cast<T*>(detail::hp_allocate(sizeof(T) * n,
+            detail::hp_alignment<T, Alignment>::value));
+    }
+
+    allocation_result<T*> allocate_at_least(std::size_t n) {
+        T* p = allocate(n);
+        if (detail::hp_mapped(sizeof(T) * n)) {
+            n = detail::hp_round(sizeof(T) * n) / sizeof(T);
+        }
+        allocation_result<T*> result = { p, n };
+        return result;
+    }
+
+    bool expand(T* p, std::size_t n, std::size_t m) BOOST_NOEXCEPT {
+        return m >= n && m <= max_size() &&
+            detail::hp_expand(p, sizeof(T) * n, sizeof(T) * m);
+    }
+
+    void deallocate(T* p, std::size_t n) {
+        detail::hp_deallocate(p, sizeof(T) * n,
+            detail::hp_alignment<T, Alignment>::value);
+    }
+
+#if defined(BOOST_NO_CXX11_ALLOCATOR)
+    T* allocate(std::size_t n, const void*) {
+        return allocate(n);
+    }
+#endif
+
+#if (defined(BOOST_LIBSTDCXX_VERSION) && BOOST_LIBSTDCXX_VERSION < 60000) || \
+    defined(BOOST_NO_CXX11_ALLOCATOR)
+    template<class U, class V>
+    void construct(U* p, const V& v) {
+        ::new(p) U(v);
+    }
+
+    template<class U>
+    void destroy(U* p) {
+        p->~U();
+        (void)p;
+    }
+#endif
+};
+
+template<class T, class U, std::size_t N>
+BOOST_CONSTEXPR inline bool
+operator==(const hugepage_allocator<T, N>&,
+    const hugepage_allocator<U, N>&) BOOST_NOEXCEPT
+{
+    return true;
+}
+
+template<class T, class U, std::size_t N>
+BOOST_CONSTEXPR inline bool
+operator!=(const hugepage_allocator<T, N>&,
+    const hugepage_allocator<U, N>&) BOOST_NOEXCEPT
+{
+    return false;
+}
+
+} /* boost */
+
+#endif
@@ -0,0 +1,44 @@
+/*
+Copyright 2026
+
+Distributed under the Boost Software License, Version 1.0.
+(http://www.boost.org/LICENSE_1_0.txt)
+*/
+#ifndef BOOST_CORE_IS_TRIVIALLY_RELOCATABLE_HPP
+#define BOOST_CORE_IS_TRIVIALLY_RELOCATABLE_HPP
+
+#include <boost/config.hpp>
+#if !defined(BOOST_NO_CXX11_HDR_TYPE_TRAITS) && \
+    !(defined(BOOST_LIBSTDCXX_VERSION) && BOOST_LIBSTDCXX_VERSION < 50000)
+#include <type_traits>
+#define BOOST_CORE_DETAIL_TRIVIALLY_COPYABLE
+#endif
+
+namespace boost {
+
+/*
+An object of a trivially relocatable type can be moved to new storage and its
+old storage released by copying its bytes, without calling a constructor or a
+destructor. Trivially copyable types are. Other types, for example ones that
+own a heap block through a pointer, can opt in by specialization.
+*/
+#if defined(BOOST_CORE_DETAIL_TRIVIALLY_COPYABLE)
+template<class T>
+struct is_trivially_relocatable
+    : std::integral_constant<bool, std::is_trivially_copyable<T>::value &&
+        !std::is_volatile<T>::value> { };
+#else
+template<class T>
+struct is_trivially_relocatable {
+    BOOST_STATIC_CONSTEXPR bool value = false;
+};
+
+template<class T>
+BOOST_CONSTEXPR_OR_CONST bool is_trivially_relocatable<T>::value;
+#endif
+
+} /* boost */
+
+#undef BOOST_CORE_DETAIL_TRIVIALLY_COPYABLE
+
+#endif
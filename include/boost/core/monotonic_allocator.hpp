@@ -0,0 +1,246 @@
+/*
+Copyright 2026
+
+Distributed under the Boost Software License, Version 1.0.
+(http://www.boost.org/LICENSE_1_0.txt)
+*/
+#ifndef BOOST_CORE_MONOTONIC_ALLOCATOR_HPP
+#define BOOST_CORE_MONOTONIC_ALLOCATOR_HPP
+
+#include <boost/config.hpp>
+#include <cstddef>
+#include <new>
+
+namespace boost {
+
+#if defined(BOOST_NO_EXCEPTIONS)
+BOOST_NORETURN void throw_exception(const std::exception&);
+#endif
+
+namespace detail {
+
+template<class T>
+struct mono_align_of {
+    struct type {
+        char c;
+        T t;
+    };
+
+    static const std::size_t value = sizeof(type) - sizeof(T);
+};
+
+template<class T>
+const std::size_t mono_align_of<T>::value;
+
+BOOST_NORETURN inline void
+mono_bad_alloc()
+{
+#if !defined(BOOST_NO_EXCEPTIONS)
+    throw std::bad_alloc();
+#else
+    boost::throw_exception(std::bad_alloc());
+#endif
+}
+
+inline void*
+mono_operator_new(std::size_t n)
+{
+#if !defined(BOOST_NO_EXCEPTIONS)
+    return ::operator new(n);
+#else
+    void* p = ::operator new(n, std::nothrow);
+    if (!p) {
+        detail::mono_bad_alloc();
+    }
+    return p;
+#endif
+}
+
+} /* detail */
+
+class monotonic_arena {
+public:
+    monotonic_arena() BOOST_NOEXCEPT
+        : blocks_(0)
+        , buffer_(0)
+        , buffer_size_(0)
+        , initial_size_(1024)
+        , next_size_(1024)
+        , ptr_(0)
+        , end_(0) { }
+
+    explicit monotonic_arena(std::size_t block_size) BOOST_NOEXCEPT
+        : blocks_(0)
+        , buffer_(0)
+        , buffer_size_(0)
+        , initial_size_(block_size ? block_size : 1)
+        , next_size_(initial_size_)
+        , ptr_(0)
+        , end_(0) { }
+
+    monotonic_arena(void* buffer, std::size_t size) BOOST_NOEXCEPT
+        : blocks_(0)
+        , buffer_(static_cast<char*>(buffer))
+        , buffer_size_(size)
+        , initial_size_(size > 1024 ? size : 1024)
+        , next_size_(initial_size_)
+        , ptr_(buffer_)
+        , end_(buffer_ + size) { }
+
+    ~monotonic_arena() {
+        release();
+    }
+
+    void* allocate(std::size_t size, std::size_t align) {
+        std::size_t a = (0 - reinterpret_cast<std::size_t>(ptr_)) &
+            (align - 1);
+        std::size_t n = static_cast<std::size_t>(end_ - ptr_);
+        if (a <= n && size <= n - a) {
+            char* p = ptr_ + a;
+            ptr_ = p + size;
+            return p;
+        }
+        return grow(size, align);
+    }
+
+    void reset() BOOST_NOEXCEPT {
+        release();
+        next_size_ = initial_size_;
+        ptr_ = buffer_;
+        end_ = buffer_ + buffer_size_;
+    }
+
+    std::size_t remaining() const BOOST_NOEXCEPT {
+        return static_cast<std::size_t>(end_ - ptr_);
+    }
+
+private:
+    struct block {
+        block* next;
+    };
+
+    monotonic_arena(const monotonic_arena&);
+    monotonic_arena& operator=(const monotonic_arena&);
+
+    void release() BOOST_NOEXCEPT {
+        while (blocks_) {
+            block* b = blocks_;
+            blocks_ = b->next;
+            ::operator delete(b);
+        }
+    }
+
+    void* grow(std::size_t size, std::size_t align) {
+        const std::size_t h = sizeof(block);
+        std::size_t m = static_cast<std::size_t>(-1) - h;
+        if (size > m || align - 1 > m - size) {
+            detail::mono_bad_alloc();
+        }
+        std::size_t n = size + align - 1;
+        if (n < next_size_) {
+            n = next_size_;
+        }
+        block* b = static_cast<block*>(detail::mono_operator_new(h + n));
+        b->next = blocks_;
+        blocks_ = b;
+        if (next_size_ <= m / 2) {
+            next_size_ *= 2;
+        }
+        char* p = reinterpret_cast<char*>(b) + h;
+        std::size_t a = (0 - reinterpret_cast<std::size_t>(p)) & (align - 1);
+        ptr_ = p + a + size;
+        end_ = p + n;
+        return p + a;
+    }
+
+    block* blocks_;
+    char* buffer_;
+    std::size_t buffer_size_;
+    std::size_t initial_size_;
+    std::size_t next_size_;
+    char* ptr_;
+    char* end_;
+};
+
+template<class T>
+class monotonic_allocator {
+public:
+    typedef T value_type;
+
+    template<class U>
+    struct rebind {
+        typedef monotonic_allocator<U> other;
+    };
+
+    explicit monotonic_allocator(monotonic_arena& arena) BOOST_NOEXCEPT
+        : arena_(&arena) { }
+
+    template<class U>
+    monotonic_allocator(const monotonic_allocator<U>& other) BOOST_NOEXCEPT
+        : arena_(&other.arena()) { }
+
+    T* allocate(std::size_t n) {
+        if (n > static_cast<std::size_t>(-1) / sizeof(T)) {
+            detail::mono_bad_alloc();
+        }
+        return static_cast<T*>(arena_->allocate(sizeof(T) * n,
+            detail::mono_align_of<T>::value));
+    }
+
+    void deallocate(T*, std::size_t) BOOST_NOEXCEPT { }
+
+#if defined(BOOST_NO_CXX11_ALLOCATOR)
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    T* allocate(std::size_t n, const void*) {
+        return allocate(n);
+    }
+
+    std::size_t max_size() const BOOST_NOEXCEPT {
+        return static_cast<std::size_t>(-1) / sizeof(T);
+    }
+
+    template<class U, class V>
+    void construct(U* p, const V& v) {
+        ::new(static_cast<void*>(p)) U(v);
+    }
+
+    template<class U>
+    void destroy(U* p) {
+        p->~U();
+        (void)p;
+    }
+#endif
+
+    monotonic_arena& arena() const BOOST_NOEXCEPT {
+        return *arena_;
+    }
+
+private:
+    monotonic_arena* arena_;
+};
+
+template<class T, class U>
+inline bool
+operator==(const monotonic_allocator<T>& lhs,
+    const monotonic_allocator<U>& rhs) BOOST_NOEXCEPT
+{
+    return &lhs.arena() == &rhs.arena();
+}
+
+template<class T, class U>
+inline bool
+operator!=(const monotonic_allocator<T>& lhs,
+    const monotonic_allocator<U>& rhs) BOOST_NOEXCEPT
+{
+    return !(lhs == rhs);
+}
+
+} /* boost */
+
+#endif
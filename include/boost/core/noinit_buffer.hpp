@@ -0,0 +1,380 @@
+/*
+Copyright 2026
+
+Distributed under the Boost Software License, Version 1.0.
+(http://www.boost.org/LICENSE_1_0.txt)
+*/
+#ifndef BOOST_CORE_NOINIT_BUFFER_HPP
+#define BOOST_CORE_NOINIT_BUFFER_HPP
+
+#include <boost/core/allocator_access.hpp>
+#include <boost/core/empty_value.hpp>
+#include <boost/core/noinit_adaptor.hpp>
+#include <boost/core/pointer_traits.hpp>
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#if !defined(BOOST_NO_CXX11_HDR_TYPE_TRAITS) && \
+    !(defined(BOOST_LIBSTDCXX_VERSION) && BOOST_LIBSTDCXX_VERSION < 50000)
+#include <type_traits>
+#define BOOST_CORE_NOINIT_BUFFER_TRIVIAL
+#endif
+
+namespace boost {
+
+#if defined(BOOST_NO_EXCEPTIONS)
+BOOST_NORETURN void throw_exception(const std::exception&);
+#endif
+
+namespace core {
+namespace detail {
+
+BOOST_NORETURN inline void
+noinit_buffer_length_error()
+{
+#if !defined(BOOST_NO_EXCEPTIONS)
+    throw std::length_error("boost::core::noinit_buffer");
+#else
+    boost::throw_exception(std::length_error("boost::core::noinit_buffer"));
+#endif
+}
+
+template<bool>
+struct noinit_buffer_swap {
+    template<class A>
+    static void swap(A& a, A& b) {
+        using std::swap;
+        swap(a, b);
+    }
+};
+
+template<>
+struct noinit_buffer_swap<false> {
+    template<class A>
+    static void swap(A& a, A& b) BOOST_NOEXCEPT {
+        BOOST_ASSERT(a == b);
+        (void)a;
+        (void)b;
+    }
+};
+
+} /* detail */
+
+/*
+The first N elements are stored in the object itself. Growth never constructs
+the new elements beyond what noinit_adaptor does, which is nothing for the
+trivial types this holds, and relocation is a memcpy. resize and
+reserve_at_least take exactly what is asked for, plus whatever slack the
+allocator reports through allocate_at_least. Only prepare grows by half of
+the capacity, so that a loop of prepare and commit takes linear time.
+*/
+template<class T, std::size_t N = 256 / sizeof(T),
+    class A = std::allocator<T> >
+class noinit_buffer
+    : empty_value<noinit_adaptor<typename allocator_rebind<A, T>::type> > {
+    typedef empty_value<noinit_adaptor<typename allocator_rebind<A,
+        T>::type> > base;
+
+#if defined(BOOST_CORE_NOINIT_BUFFER_TRIVIAL)
+    BOOST_STATIC_ASSERT(std::is_trivially_copyable<T>::value &&
+        std::is_trivially_default_constructible<T>::value);
+#endif
+
+public:
+    typedef T value_type;
+    typedef noinit_adaptor<typename allocator_rebind<A, T>::type>
+        allocator_type;
+    typedef typename allocator_size_type<allocator_type>::type size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T* iterator;
+    typedef const T* const_iterator;
+
+    noinit_buffer()
+        : base(empty_init_t())
+        , data_(local_)
+        , size_(0)
+        , capacity_(N) { }
+
+    explicit noinit_buffer(const allocator_type& a)
+        : base(empty_init_t(), a)
+        , data_(local_)
+        , size_(0)
+        , capacity_(N) { }
+
+    explicit noinit_buffer(size_type n,
+        const allocator_type& a = allocator_type())
+        : base(empty_init_t(), a)
+        , data_(local_)
+        , size_(0)
+        , capacity_(N) {
+        resize(n);
+    }
+
+    noinit_buffer(const noinit_buffer& other)
+        : base(empty_init_t(),
+            boost::allocator_select_on_container_copy_construction(
+                other.get()))
+        , data_(local_)
+        , size_(0)
+        , capacity_(N) {
+        append(other.data_, other.size_);
+    }
+
+#if !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    noinit_buffer(noinit_buffer&& other) BOOST_NOEXCEPT
+        : base(empty_init_t(), std::move(other.get()))
+        , data_(local_)
+        , size_(0)
+        , capacity_(N) {
+        take(other);
+    }
+#endif
+
+    ~noinit_buffer() {
+        release();
+    }
+
+    /* the allocator is kept, whatever propagate_on_container_copy_assignment
+    and propagate_on_container_move_assignment say */
+    noinit_buffer& operator=(const noinit_buffer& other) {
+        if (this != &other) {
+            size_ = 0;
+            append(other.data_, other.size_);
+        }
+        return *this;
+    }
+
+#if !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    noinit_buffer& operator=(noinit_buffer&& other) {
+        if (this != &other) {
+            if (other.data_ != other.local_ && get() == other.get()) {
+                release();
+                data_ = local_;
+                capacity_ = N;
+                take(other);
+            } else {
+                size_ = 0;
+                append(other.data_, other.size_);
+            }
+        }
+        return *this;
+    }
+#endif
+
+    allocator_type get_allocator() const {
+        return get();
+    }
+
+    T* data() BOOST_NOEXCEPT {
+        return data_;
+    }
+
+    const T* data() const BOOST_NOEXCEPT {
+        return data_;
+    }
+
+    size_type size() const BOOST_NOEXCEPT {
+        return size_;
+    }
+
+    size_type capacity() const BOOST_NOEXCEPT {
+        return capacity_;
+    }
+
+    bool empty() const BOOST_NOEXCEPT {
+        return size_ == 0;
+    }
+
+    size_type max_size() const BOOST_NOEXCEPT {
+        return boost::allocator_max_size(get());
+    }
+
+    T* begin() BOOST_NOEXCEPT {
+        return data_;
+    }
+
+    const T* begin() const BOOST_NOEXCEPT {
+        return data_;
+    }
+
+    T* end() BOOST_NOEXCEPT {
+        return data_ + size_;
+    }
+
+    const T* end() const BOOST_NOEXCEPT {
+        return data_ + size_;
+    }
+
+    T& operator[](size_type i) BOOST_NOEXCEPT {
+        BOOST_ASSERT(i < size_);
+        return data_[i];
+    }
+
+    const T& operator[](size_type i) const BOOST_NOEXCEPT {
+        BOOST_ASSERT(i < size_);
+        return data_[i];
+    }
+
+    void clear() BOOST_NOEXCEPT {
+        boost::allocator_destroy_n(get(), data_, size_);
+        size_ = 0;
+    }
+
+    void reserve_at_least(size_type n) {
+        if (n > capacity_) {
+            grow(n);
+        }
+    }
+
+    void resize(size_type n) {
+        if (n > size_) {
+            reserve_at_least(n);
+            boost::allocator_construct_n(get(), data_ + size_, n - size_);
+        } else {
+            boost::allocator_destroy_n(get(), data_ + n, size_ - n);
+        }
+        size_ = n;
+    }
+
+    T* prepare(size_type n) {
+        if (n > capacity_ - size_) {
+            const size_type m = max_size();
+            if (n > m - size_) {
+                detail::noinit_buffer_length_error();
+            }
+            size_type c = capacity_ + capacity_ / 2;
+            if (c < capacity_ || c > m) {
+                c = m;
+            }
+            grow(size_ + n > c ? size_ + n : c);
+        }
+        return data_ + size_;
+    }
+
+    void commit(size_type n) BOOST_NOEXCEPT {
+        BOOST_ASSERT(n <= capacity_ - size_);
+        size_ += n;
+    }
+
+    void append(const T* p, size_type n) {
+        if (n != 0) {
+            if (p >= data_ && p < data_ + size_) {
+                const std::size_t i = p - data_;
+                p = prepare(n) - size_ + i;
+            } else {
+                prepare(n);
+            }
+            std::memmove(static_cast<void*>(data_ + size_),
+                static_cast<const void*>(p), sizeof(T) * n);
+            size_ += n;
+        }
+    }
+
+    void swap(noinit_buffer& other) {
+        detail::noinit_buffer_swap<allocator_propagate_on_container_swap<
+            allocator_type>::type::value>::swap(get(), other.get());
+        swap_storage(other);
+    }
+
+private:
+    typedef typename allocator_pointer<allocator_type>::type heap_pointer;
+
+    using base::get;
+
+    void swap_storage(noinit_buffer& other) BOOST_NOEXCEPT {
+        if (data_ != local_ && other.data_ != other.local_) {
+            std::swap(data_, other.data_);
+            std::swap(capacity_, other.capacity_);
+            std::swap(size_, other.size_);
+        } else if (data_ == local_ && other.data_ == other.local_) {
+            T t[N ? N : 1];
+            std::memcpy(static_cast<void*>(t), local_, sizeof(T) * size_);
+            std::memcpy(static_cast<void*>(local_), other.local_,
+                sizeof(T) * other.size_);
+            std::memcpy(static_cast<void*>(other.local_), t,
+                sizeof(T) * size_);
+            std::swap(size_, other.size_);
+        } else if (data_ == local_) {
+            other.swap_storage(*this);
+        } else {
+            std::memcpy(static_cast<void*>(local_), other.local_,
+                sizeof(T) * other.size_);
+            other.data_ = data_;
+            data_ = local_;
+            std::swap(capacity_, other.capacity_);
+            std::swap(size_, other.size_);
+        }
+    }
+
+    static heap_pointer to_pointer(T* p) BOOST_NOEXCEPT {
+        return boost::pointer_traits<heap_pointer>::pointer_to(*p);
+    }
+
+    void grow(size_type m) {
+        if (m > max_size()) {
+            detail::noinit_buffer_length_error();
+        }
+        if (data_ != local_ &&
+            boost::allocator_expand(get(), to_pointer(data_), capacity_, m)) {
+            capacity_ = m;
+            return;
+        }
+        allocation_result<heap_pointer, size_type> r =
+            boost::allocator_allocate_at_least(get(), m);
+        T* p = boost::to_address(r.ptr);
+        if (size_ != 0) {
+            std::memcpy(static_cast<void*>(p), data_, sizeof(T) * size_);
+        }
+        release();
+        data_ = p;
+        capacity_ = r.count;
+    }
+
+    void release() BOOST_NOEXCEPT {
+        if (data_ != local_) {
+            boost::allocator_deallocate(get(), to_pointer(data_), capacity_);
+        }
+    }
+
+    void take(noinit_buffer& other) BOOST_NOEXCEPT {
+        if (other.data_ != other.local_) {
+            data_ = other.data_;
+            capacity_ = other.capacity_;
+            other.data_ = other.local_;
+            other.capacity_ = N;
+        } else if (other.size_ != 0) {
+            std::memcpy(static_cast<void*>(local_), other.local_,
+                sizeof(T) * other.size_);
+        }
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+
+    T* data_;
+    size_type size_;
+    size_type capacity_;
+    T local_[N ? N : 1];
+};
+
+template<class T, std::size_t N, class A>
+inline void
+swap(noinit_buffer<T, N, A>& lhs, noinit_buffer<T, N, A>& rhs)
+{
+    lhs.swap(rhs);
+}
+
+} /* core */
+} /* boost */
+
+#undef BOOST_CORE_NOINIT_BUFFER_TRIVIAL
+
+#endif
@@ -0,0 +1,260 @@
+/*
+Copyright 2026
+
+Distributed under the Boost Software License, Version 1.0.
+(http://www.boost.org/LICENSE_1_0.txt)
+*/
+#ifndef BOOST_CORE_NUMA_ALLOCATOR_HPP
+#define BOOST_CORE_NUMA_ALLOCATOR_HPP
+
+#include <boost/config.hpp>
+#include <cstddef>
+#include <new>
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#if defined(SYS_mbind) && defined(SYS_getcpu) && defined(MAP_ANONYMOUS)
+#define BOOST_CORE_NUMA_ALLOCATOR_MBIND
+#endif
+#endif
+
+namespace boost {
+
+#if defined(BOOST_NO_EXCEPTIONS)
+BOOST_NORETURN void throw_exception(const std::exception&);
+#endif
+
+namespace detail {
+
+/*
+Requests of at least a page are mapped and given a preferred node with the
+mbind system call, which needs neither libnuma nor privileges. When the call
+fails, for example on a kernel without NUMA support or under a seccomp
+filter, the mapping is kept and the kernel places it by first touch. Smaller
+requests share pages with other allocations, so they are not placed.
+*/
+enum {
+    numa_preferred = 1,
+    numa_max_nodes = 1024,
+    numa_word_bits = sizeof(unsigned long) * 8
+};
+
+BOOST_NORETURN inline void
+numa_bad_alloc()
+{
+#if !defined(BOOST_NO_EXCEPTIONS)
+    throw std::bad_alloc();
+#else
+    boost::throw_exception(std::bad_alloc());
+#endif
+}
+
+inline void*
+numa_operator_new(std::size_t n)
+{
+#if !defined(BOOST_NO_EXCEPTIONS)
+    return ::operator new(n);
+#else
+    void* p = ::operator new(n, std::nothrow);
+    if (!p) {
+        detail::numa_bad_alloc();
+    }
+    return p;
+#endif
+}
+
+inline void
+numa_operator_delete(void* p) BOOST_NOEXCEPT
+{
+#if !defined(BOOST_NO_EXCEPTIONS)
+    ::operator delete(p);
+#else
+    ::operator delete(p, std::nothrow);
+#endif
+}
+
+inline int
+numa_current_node() BOOST_NOEXCEPT
+{
+#if defined(BOOST_CORE_NUMA_ALLOCATOR_MBIND)
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (::syscall(SYS_getcpu, &cpu, &node, 0) == 0) {
+        return static_cast<int>(node);
+    }
+#endif
+    return -1;
+}
+
+#if defined(BOOST_CORE_NUMA_ALLOCATOR_MBIND)
+inline std::size_t
+numa_page_size() BOOST_NOEXCEPT
+{
+    return static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+}
+
+inline std::size_t
+numa_round(std::size_t n) BOOST_NOEXCEPT
+{
+    const std::size_t p = detail::numa_page_size();
+    return (n + (p - 1)) & ~(p - 1);
+}
+
+inline bool
+numa_mapped(std::size_t n) BOOST_NOEXCEPT
+{
+    return n >= detail::numa_page_size();
+}
+
+inline void
+numa_bind(void* p, std::size_t n, int node) BOOST_NOEXCEPT
+{
+    if (node < 0) {
+        node = detail::numa_current_node();
+    }
+    if (node < 0 || node >= numa_max_nodes) {
+        return;
+    }
+    unsigned long mask[numa_max_nodes / numa_word_bits] = { 0 };
+    mask[node / numa_word_bits] = 1UL << (node % numa_word_bits);
+    /* the kernel ignores the last bit of maxnode */
+    (void)::syscall(SYS_mbind, p, n, static_cast<int>(numa_preferred), mask,
+        static_cast<unsigned long>(node / numa_word_bits + 1) *
+            numa_word_bits + 1, 0U);
+}
+#endif
+
+inline void*
+numa_allocate(std::size_t n, int node)
+{
+#if defined(BOOST_CORE_NUMA_ALLOCATOR_MBIND)
+    if (detail::numa_mapped(n)) {
+        const std::size_t s = detail::numa_round(n);
+        if (s < n) {
+            detail::numa_bad_alloc();
+        }
+        void* p = ::mmap(0, s, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED) {
+            detail::numa_bad_alloc();
+        }
+        detail::numa_bind(p, s, node);
+        return p;
+    }
+#else
+    (void)node;
+#endif
+    return detail::numa_operator_new(n);
+}
+
+inline void
+numa_deallocate(void* p, std::size_t n) BOOST_NOEXCEPT
+{
+#if defined(BOOST_CORE_NUMA_ALLOCATOR_MBIND)
+    if (detail::numa_mapped(n)) {
+        ::munmap(p, detail::numa_round(n));
+        return;
+    }
+#else
+    (void)n;
+#endif
+    detail::numa_operator_delete(p);
+}
+
+} /* detail */
+
+template<class T>
+class numa_allocator {
+public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+#if defined(BOOST_NO_CXX11_ALLOCATOR)
+    typedef T& reference;
+    typedef const T& const_reference;
+#endif
+
+    template<class U>
+    struct rebind {
+        typedef numa_allocator<U> other;
+    };
+
+    numa_allocator() BOOST_NOEXCEPT
+        : node_(-1) { }
+
+    explicit numa_allocator(int node) BOOST_NOEXCEPT
+        : node_(node) { }
+
+    template<class U>
+    numa_allocator(const numa_allocator<U>& other) BOOST_NOEXCEPT
+        : node_(other.node()) { }
+
+    std::size_t max_size() const BOOST_NOEXCEPT {
+        return static_cast<std::size_t>(-1) / 2 / sizeof(T);
+    }
+
+    T* allocate(std::size_t n) {
+        if (n > max_size()) {
+            detail::numa_bad_alloc();
+        }
+        return static_cast<T*>(detail::numa_allocate(sizeof(T) * n, node_));
+    }
+
+    void deallocate(T* p, std::size_t n) BOOST_NOEXCEPT {
+        detail::numa_deallocate(p, sizeof(T) * n);
+    }
+
+#if defined(BOOST_NO_CXX11_ALLOCATOR)
+    T* allocate(std::size_t n, const void*) {
+        return allocate(n);
+    }
+#endif
+
+#if (defined(BOOST_LIBSTDCXX_VERSION) && BOOST_LIBSTDCXX_VERSION < 60000) || \
+    defined(BOOST_NO_CXX11_ALLOCATOR)
+    template<class U, class V>
+    void construct(U* p, const V& v) {
+        ::new(p) U(v);
+    }
+
+    template<class U>
+    void destroy(U* p) {
+        p->~U();
+        (void)p;
+    }
+#endif
+
+    int node() const BOOST_NOEXCEPT {
+        return node_;
+    }
+
+private:
+    int node_;
+};
+
+template<class T, class U>
+inline bool
+operator==(const numa_allocator<T>&, const numa_allocator<U>&) BOOST_NOEXCEPT
+{
+    return true;
+}
+
+template<class T, class U>
+inline bool
+operator!=(const numa_allocator<T>&, const numa_allocator<U>&) BOOST_NOEXCEPT
+{
+    return false;
+}
+
+inline int
+numa_current_node() BOOST_NOEXCEPT
+{
+    return detail::numa_current_node();
+}
+
+} /* boost */
+
+#endif
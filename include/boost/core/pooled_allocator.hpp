@@ -0,0 +1,407 @@
+/*
+Copyright 2026
+
+Distributed under the Boost Software License, Version 1.0.
+(http://www.boost.org/LICENSE_1_0.txt)
+*/
+#ifndef BOOST_CORE_POOLED_ALLOCATOR_HPP
+#define BOOST_CORE_POOLED_ALLOCATOR_HPP
+
+#include <boost/config.hpp>
+#include <boost/core/allocation_result.hpp>
+#include <cstddef>
+#include <new>
+
+#if !defined(BOOST_NO_CXX11_THREAD_LOCAL) && \
+    !defined(BOOST_NO_CXX11_HDR_ATOMIC) && \
+    !defined(BOOST_NO_CXX11_HDR_TYPE_TRAITS)
+#define BOOST_CORE_POOLED_ALLOCATOR_CACHE
+#include <atomic>
+#include <type_traits>
+#endif
+
+namespace boost {
+
+#if defined(BOOST_NO_EXCEPTIONS)
+BOOST_NORETURN void throw_exception(const std::exception&);
+#endif
+
+namespace detail {
+
+template<class T>
+struct pool_align_of {
+    struct type {
+        char c;
+        T t;
+    };
+
+    static const std::size_t value = sizeof(type) - sizeof(T);
+};
+
+template<class T>
+const std::size_t pool_align_of<T>::value;
+
+union pool_max_align {
+    long double ld;
+    long l;
+    double d;
+    void* p;
+    void (*f)();
+};
+
+BOOST_NORETURN inline void
+pool_bad_alloc()
+{
+#if !defined(BOOST_NO_EXCEPTIONS)
+    throw std::bad_alloc();
+#else
+    boost::throw_exception(std::bad_alloc());
+#endif
+}
+
+inline void*
+pool_operator_new(std::size_t n)
+{
+#if !defined(BOOST_NO_EXCEPTIONS)
+    return ::operator new(n);
+#else
+    void* p = ::operator new(n, std::nothrow);
+    if (!p) {
+        detail::pool_bad_alloc();
+    }
+    return p;
+#endif
+}
+
+inline void
+pool_operator_delete(void* p) BOOST_NOEXCEPT
+{
+#if !defined(BOOST_NO_EXCEPTIONS)
+    ::operator delete(p);
+#else
+    ::operator delete(p, std::nothrow);
+#endif
+}
+
+/*
+Sizes up to pool_max_size are rounded up to a multiple of pool_granularity,
+giving pool_classes size classes. Each class has a free list per thread,
+holding at most pool_limit blocks, and a global stack of batches of at most
+pool_batch blocks. A thread whose list exceeds the limit pushes a batch to
+the global stack. A thread whose list is empty takes the next of its spare
+batches, or else takes the whole global stack as its spares. The stack is
+pushed to with compare and swap and emptied with exchange, so it is lock
+free and not subject to ABA. The spares of a thread are returned to the
+global stack when the thread exits. New blocks are carved from slabs of pool_slab_size
+bytes, which are never returned to the system.
+*/
+enum {
+    pool_granularity = 16,
+    pool_classes = 16,
+    pool_max_size = pool_granularity * pool_classes,
+    pool_limit = 256,
+    pool_batch = pool_limit / 2,
+    pool_slab_size = 16384
+};
+
+/* Slabs come from ::operator new, so blocks are aligned to no more than it
+guarantees, and to no more than the granularity. */
+struct pool_alignment {
+#if defined(__cpp_aligned_new)
+    static const std::size_t align = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+#else
+    static const std::size_t align = pool_align_of<pool_max_align>::value;
+#endif
+    static const std::size_t value = align < std::size_t(pool_granularity) ?
+        align : std::size_t(pool_granularity);
+};
+
+inline std::size_t
+pool_class(std::size_t n) BOOST_NOEXCEPT
+{
+    return n == 0 ? 0 : (n - 1) / pool_granularity;
+}
+
+#if defined(BOOST_CORE_POOLED_ALLOCATOR_CACHE)
+struct pool_node {
+    pool_node* next;
+    pool_node* batch;
+};
+
+template<class = void>
+struct pool_global {
+    static std::atomic<pool_node*> batches[pool_classes];
+    static std::atomic<pool_node*> slabs;
+};
+
+template<class V>
+std::atomic<pool_node*> pool_global<V>::batches[pool_classes];
+
+template<class V>
+std::atomic<pool_node*> pool_global<V>::slabs;
+
+/* pushes the batches f to l, linked through batch */
+inline void
+pool_push(std::atomic<pool_node*>& h, pool_node* f, pool_node* l)
+    BOOST_NOEXCEPT
+{
+    pool_node* n = h.load(std::memory_order_relaxed);
+    do {
+        l->batch = n;
+    } while (!h.compare_exchange_weak(n, f, std::memory_order_release,
+        std::memory_order_relaxed));
+}
+
+struct pool_cache {
+    pool_node* heads[pool_classes];
+    pool_node* spares[pool_classes];
+    std::size_t sizes[pool_classes];
+    int state;
+};
+
+inline pool_cache&
+pool_local() BOOST_NOEXCEPT
+{
+    static thread_local pool_cache c;
+    return c;
+}
+
+inline void
+pool_flush(pool_cache& c, std::size_t k, std::size_t n) BOOST_NOEXCEPT
+{
+    pool_node* f = c.heads[k];
+    pool_node* l = f;
+    for (std::size_t i = 1; i < n; ++i) {
+        l = l->next;
+    }
+    c.heads[k] = l->next;
+    c.sizes[k] -= n;
+    l->next = 0;
+    detail::pool_push(pool_global<>::batches[k], f, f);
+}
+
+struct pool_guard {
+    ~pool_guard() {
+        pool_cache& c = detail::pool_local();
+        for (std::size_t k = 0; k < pool_classes; ++k) {
+            while (c.sizes[k] != 0) {
+                detail::pool_flush(c, k, c.sizes[k] < pool_batch ?
+                    c.sizes[k] : static_cast<std::size_t>(pool_batch));
+            }
+            if (pool_node* f = c.spares[k]) {
+                pool_node* l = f;
+                while (l->batch) {
+                    l = l->batch;
+                }
+                detail::pool_push(pool_global<>::batches[k], f, l);
+                c.spares[k] = 0;
+            }
+        }
+        c.state = 2;
+    }
+};
+
+/* null while the thread is exiting */
+inline pool_cache*
+pool_get()
+{
+    pool_cache& c = detail::pool_local();
+    if (c.state != 1) {
+        if (c.state == 2) {
+            return 0;
+        }
+        static thread_local pool_guard g;
+        (void)&g;
+        c.state = 1;
+    }
+    return &c;
+}
+
+inline pool_node*
+pool_refill(pool_cache& c, std::size_t k)
+{
+    pool_node* b = c.spares[k];
+    if (!b) {
+        b = pool_global<>::batches[k].exchange(0, std::memory_order_acquire);
+    }
+    if (b) {
+        c.spares[k] = b->batch;
+        std::size_t n = 0;
+        for (pool_node* p = b->next; p; p = p->next) {
+            ++n;
+        }
+        c.heads[k] = b->next;
+        c.sizes[k] = n;
+        return b;
+    }
+    const std::size_t s = (k + 1) * pool_granularity;
+    char* p = static_cast<char*>(detail::pool_operator_new(pool_slab_size));
+    pool_node* h = reinterpret_cast<pool_node*>(p);
+    detail::pool_push(pool_global<>::slabs, h, h);
+    p += pool_granularity;
+    std::size_t n = (pool_slab_size - pool_granularity) / s;
+    pool_node* l = 0;
+    for (std::size_t i = n; i > 1; --i) {
+        pool_node* q = reinterpret_cast<pool_node*>(p + (i - 1) * s);
+        q->next = l;
+        l = q;
+    }
+    c.heads[k] = l;
+    c.sizes[k] = n - 1;
+    return reinterpret_cast<pool_node*>(p);
+}
+
+inline void*
+pool_allocate(std::size_t k)
+{
+    pool_cache* c = detail::pool_get();
+    if (!c) {
+        return detail::pool_operator_new((k + 1) * pool_granularity);
+    }
+    pool_node* p = c->heads[k];
+    if (p) {
+        c->heads[k] = p->next;
+        --c->sizes[k];
+        return p;
+    }
+    return detail::pool_refill(*c, k);
+}
+
+inline void
+pool_deallocate(void* p, std::size_t k) BOOST_NOEXCEPT
+{
+    pool_node* n = static_cast<pool_node*>(p);
+    pool_cache* c = detail::pool_get();
+    if (!c) {
+        n->next = 0;
+        detail::pool_push(pool_global<>::batches[k], n, n);
+        return;
+    }
+    n->next = c->heads[k];
+    c->heads[k] = n;
+    if (++c->sizes[k] > pool_limit) {
+        detail::pool_flush(*c, k, pool_batch);
+    }
+}
+#endif
+
+} /* detail */
+
+template<class T>
+struct pooled_allocator {
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+#if defined(BOOST_NO_CXX11_ALLOCATOR)
+    typedef T& reference;
+    typedef const T& const_reference;
+#endif
+#if defined(BOOST_CORE_POOLED_ALLOCATOR_CACHE)
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type is_always_equal;
+#endif
+
+    template<class U>
+    struct rebind {
+        typedef pooled_allocator<U> other;
+    };
+
+#if !defined(BOOST_NO_CXX11_DEFAULTED_FUNCTIONS)
+    pooled_allocator() = default;
+#else
+    BOOST_CONSTEXPR pooled_allocator() BOOST_NOEXCEPT { }
+#endif
+
+    template<class U>
+    BOOST_CONSTEXPR pooled_allocator(const pooled_allocator<U>&)
+        BOOST_NOEXCEPT { }
+
+    BOOST_CONSTEXPR std::size_t max_size() const BOOST_NOEXCEPT {
+        return static_cast<std::size_t>(-1) / sizeof(T);
+    }
+
+    T* allocate(std::size_t n) {
+        if (n > max_size()) {
+            detail::pool_bad_alloc();
+        }
+#if defined(BOOST_CORE_POOLED_ALLOCATOR_CACHE)
+        if (pooled(n)) {
+            return static_cast<T*>(detail::pool_allocate(detail::
+                pool_class(sizeof(T) * n)));
+        }
+#endif
+        return static_cast<T*>(detail::pool_operator_new(sizeof(T) * n));
+    }
+
+    void deallocate(T* p, std::size_t n) {
+#if defined(BOOST_CORE_POOLED_ALLOCATOR_CACHE)
+        if (pooled(n)) {
+            detail::pool_deallocate(p, detail::pool_class(sizeof(T) * n));
+            return;
+        }
+#endif
+        (void)n;
+        detail::pool_operator_delete(p);
+    }
+
+    allocation_result<T*> allocate_at_least(std::size_t n) {
+        T* p = allocate(n);
+#if defined(BOOST_CORE_POOLED_ALLOCATOR_CACHE)
+        if (pooled(n)) {
+            n = (detail::pool_class(sizeof(T) * n) + 1) *
+                detail::pool_granularity / sizeof(T);
+        }
+#endif
+        allocation_result<T*> result = { p, n };
+        return result;
+    }
+
+#if defined(BOOST_NO_CXX11_ALLOCATOR)
+    T* allocate(std::size_t n, const void*) {
+        return allocate(n);
+    }
+#endif
+
+#if (defined(BOOST_LIBSTDCXX_VERSION) && BOOST_LIBSTDCXX_VERSION < 60000) || \
+    defined(BOOST_NO_CXX11_ALLOCATOR)
+    template<class U, class V>
+    void construct(U* p, const V& v) {
+        ::new(p) U(v);
+    }
+
+    template<class U>
+    void destroy(U* p) {
+        p->~U();
+        (void)p;
+    }
+#endif
+
+private:
+    static bool pooled(std::size_t n) BOOST_NOEXCEPT {
+        return detail::pool_align_of<T>::value <=
+            detail::pool_alignment::value &&
+            n <= detail::pool_max_size / sizeof(T);
+    }
+};
+
+template<class T, class U>
+BOOST_CONSTEXPR inline bool
+operator==(const pooled_allocator<T>&,
+    const pooled_allocator<U>&) BOOST_NOEXCEPT
+{
+    return true;
+}
+
+template<class T, class U>
+BOOST_CONSTEXPR inline bool
+operator!=(const pooled_allocator<T>&,
+    const pooled_allocator<U>&) BOOST_NOEXCEPT
+{
+    return false;
+}
+
+} /* boost */
+
+#endif
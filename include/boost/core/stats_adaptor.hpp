@@ -0,0 +1,484 @@
+/*
+Copyright 2026
+
+Distributed under the Boost Software License, Version 1.0.
+(http://www.boost.org/LICENSE_1_0.txt)
+*/
+#ifndef BOOST_CORE_STATS_ADAPTOR_HPP
+#define BOOST_CORE_STATS_ADAPTOR_HPP
+
+#include <boost/core/allocator_access.hpp>
+#include <boost/core/bit.hpp>
+#include <boost/cstdint.hpp>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+#include <utility>
+
+namespace boost {
+
+struct allocator_stats {
+    enum {
+        buckets = 48
+    };
+
+    boost::uint64_t allocations;
+    boost::uint64_t deallocations;
+    boost::uint64_t bytes_allocated;
+    boost::uint64_t bytes_deallocated;
+    boost::uint64_t peak_bytes;
+    boost::uint64_t sizes[buckets];
+    boost::uint64_t lifetimes[buckets];
+
+    boost::uint64_t bytes() const noexcept {
+        return bytes_allocated - bytes_deallocated;
+    }
+};
+
+namespace detail {
+
+/*
+Each thread counts into its own slot, which only that thread writes, so the
+counters are updated with plain relaxed loads and stores. The slots of live
+threads are linked into a list that a snapshot walks under the mutex, and a
+thread adds its counts to the totals when it exits. The bytes in use are
+flushed to a shared counter once the change seen by a thread exceeds
+stats_flush bytes, which is where the peak is taken. One in 2^stats_sample
+blocks, chosen by a hash of the address, has its time of allocation recorded
+in a map so that its lifetime can be measured.
+*/
+enum {
+    stats_flush = 65536,
+    stats_sample = 6
+};
+
+typedef std::atomic<boost::uint64_t> stats_counter;
+
+struct stats_slot {
+    stats_counter allocations;
+    stats_counter deallocations;
+    stats_counter bytes_allocated;
+    stats_counter bytes_deallocated;
+    stats_counter sizes[allocator_stats::buckets];
+    boost::int64_t pending;
+    stats_slot* prev;
+    stats_slot* next;
+    int state;
+};
+
+struct stats_global {
+    stats_global()
+        : totals()
+        , slots()
+        , bytes(0)
+        , peak(0) { }
+
+    std::mutex mutex;
+    allocator_stats totals;
+    stats_slot* slots;
+    std::unordered_map<const void*,
+        std::chrono::steady_clock::time_point> sampled;
+    std::atomic<boost::int64_t> bytes;
+    std::atomic<boost::int64_t> peak;
+};
+
+/* never destroyed, so that containers destroyed late can still report */
+template<class Tag>
+inline stats_global&
+stats_state()
+{
+    static stats_global* g = new stats_global();
+    return *g;
+}
+
+template<class Tag>
+inline stats_slot&
+stats_local() noexcept
+{
+    static thread_local stats_slot s;
+    return s;
+}
+
+inline std::size_t
+stats_bucket(boost::uint64_t n) noexcept
+{
+    boost::uint64_t i = boost::core::bit_width(n);
+    return i < allocator_stats::buckets ? static_cast<std::size_t>(i) :
+        static_cast<std::size_t>(allocator_stats::buckets - 1);
+}
+
+inline void
+stats_add(stats_counter& c, boost::uint64_t n) noexcept
+{
+    c.store(c.load(std::memory_order_relaxed) + n,
+        std::memory_order_relaxed);
+}
+
+inline void
+stats_merge(allocator_stats& s, const stats_slot& t) noexcept
+{
+    s.allocations += t.allocations.load(std::memory_order_relaxed);
+    s.deallocations += t.deallocations.load(std::memory_order_relaxed);
+    s.bytes_allocated += t.bytes_allocated.load(std::memory_order_relaxed);
+    s.bytes_deallocated +=
+        t.bytes_deallocated.load(std::memory_order_relaxed);
+    for (std::size_t i = 0; i < allocator_stats::buckets; ++i) {
+        s.sizes[i] += t.sizes[i].load(std::memory_order_relaxed);
+    }
+}
+
+inline void
+stats_update(stats_global& g, boost::int64_t n) noexcept
+{
+    boost::int64_t b = g.bytes.fetch_add(n, std::memory_order_relaxed) + n;
+    boost::int64_t p = g.peak.load(std::memory_order_relaxed);
+    while (b > p && !g.peak.compare_exchange_weak(p, b,
+        std::memory_order_relaxed)) { }
+}
+
+template<class Tag>
+struct stats_guard {
+    ~stats_guard() {
+        stats_slot& s = detail::stats_local<Tag>();
+        stats_global& g = detail::stats_state<Tag>();
+        std::lock_guard<std::mutex> lock(g.mutex);
+        detail::stats_merge(g.totals, s);
+        detail::stats_update(g, s.pending);
+        if (s.prev) {
+            s.prev->next = s.next;
+        } else {
+            g.slots = s.next;
+        }
+        if (s.next) {
+            s.next->prev = s.prev;
+        }
+        s.state = 2;
+    }
+};
+
+/* null while the thread is exiting */
+template<class Tag>
+inline stats_slot*
+stats_get()
+{
+    stats_slot& s = detail::stats_local<Tag>();
+    if (s.state != 1) {
+        if (s.state == 2) {
+            return 0;
+        }
+        static thread_local stats_guard<Tag> k;
+        (void)&k;
+        stats_global& g = detail::stats_state<Tag>();
+        std::lock_guard<std::mutex> lock(g.mutex);
+        s.next = g.slots;
+        if (g.slots) {
+            g.slots->prev = &s;
+        }
+        g.slots = &s;
+        s.state = 1;
+    }
+    return &s;
+}
+
+inline bool
+stats_sampled(const void* p) noexcept
+{
+    boost::uint64_t x = reinterpret_cast<std::size_t>(p) >> 4;
+    return (x * 0x9e3779b97f4a7c15ULL) >> (64 - stats_sample) == 0;
+}
+
+template<class Tag>
+inline void
+stats_allocate(const void* p, boost::uint64_t n)
+{
+    if (stats_slot* s = detail::stats_get<Tag>()) {
+        detail::stats_add(s->allocations, 1);
+        detail::stats_add(s->bytes_allocated, n);
+        detail::stats_add(s->sizes[detail::stats_bucket(n)], 1);
+        s->pending += static_cast<boost::int64_t>(n);
+        if (s->pending > stats_flush) {
+            detail::stats_update(detail::stats_state<Tag>(), s->pending);
+            s->pending = 0;
+        }
+    } else {
+        stats_global& g = detail::stats_state<Tag>();
+        std::lock_guard<std::mutex> lock(g.mutex);
+        ++g.totals.allocations;
+        g.totals.bytes_allocated += n;
+        ++g.totals.sizes[detail::stats_bucket(n)];
+        detail::stats_update(g, static_cast<boost::int64_t>(n));
+    }
+    if (detail::stats_sampled(p)) {
+        stats_global& g = detail::stats_state<Tag>();
+        std::lock_guard<std::mutex> lock(g.mutex);
+#if !defined(BOOST_NO_EXCEPTIONS)
+        try {
+            g.sampled[p] = std::chrono::steady_clock::now();
+        } catch (...) { }
+#else
+        g.sampled[p] = std::chrono::steady_clock::now();
+#endif
+    }
+}
+
+template<class Tag>
+inline void
+stats_deallocate(const void* p, boost::uint64_t n)
+{
+    if (detail::stats_sampled(p)) {
+        stats_global& g = detail::stats_state<Tag>();
+        std::lock_guard<std::mutex> lock(g.mutex);
+        std::unordered_map<const void*,
+            std::chrono::steady_clock::time_point>::iterator i =
+                g.sampled.find(p);
+        if (i != g.sampled.end()) {
+            boost::int64_t t = std::chrono::duration_cast<std::chrono::
+                nanoseconds>(std::chrono::steady_clock::now() -
+                    i->second).count();
+            ++g.totals.lifetimes[detail::stats_bucket(t < 0 ? 0 :
+                static_cast<boost::uint64_t>(t))];
+            g.sampled.erase(i);
+        }
+    }
+    if (stats_slot* s = detail::stats_get<Tag>()) {
+        detail::stats_add(s->deallocations, 1);
+        detail::stats_add(s->bytes_deallocated, n);
+        s->pending -= static_cast<boost::int64_t>(n);
+        if (s->pending < -stats_flush) {
+            detail::stats_update(detail::stats_state<Tag>(), s->pending);
+            s->pending = 0;
+        }
+    } else {
+        stats_global& g = detail::stats_state<Tag>();
+        std::lock_guard<std::mutex> lock(g.mutex);
+        ++g.totals.deallocations;
+        g.totals.bytes_deallocated += n;
+        detail::stats_update(g, -static_cast<boost::int64_t>(n));
+    }
+}
+
+template<class Tag>
+inline void
+stats_expand(boost::uint64_t n, boost::uint64_t m)
+{
+    if (m == n) {
+        return;
+    }
+    const boost::int64_t d = m > n ? static_cast<boost::int64_t>(m - n) :
+        -static_cast<boost::int64_t>(n - m);
+    if (stats_slot* s = detail::stats_get<Tag>()) {
+        if (d > 0) {
+            detail::stats_add(s->bytes_allocated, m - n);
+        } else {
+            detail::stats_add(s->bytes_deallocated, n - m);
+        }
+        s->pending += d;
+        if (s->pending > stats_flush || s->pending < -stats_flush) {
+            detail::stats_update(detail::stats_state<Tag>(), s->pending);
+            s->pending = 0;
+        }
+    } else {
+        stats_global& g = detail::stats_state<Tag>();
+        std::lock_guard<std::mutex> lock(g.mutex);
+        if (d > 0) {
+            g.totals.bytes_allocated += m - n;
+        } else {
+            g.totals.bytes_deallocated += n - m;
+        }
+        detail::stats_update(g, d);
+    }
+}
+
+/* The old address is looked up before the move, because it must not be used
+once the allocator has released it. */
+template<class Tag>
+inline void
+stats_unmark(const void* p, std::chrono::steady_clock::time_point& t)
+{
+    if (detail::stats_sampled(p)) {
+        stats_global& g = detail::stats_state<Tag>();
+        std::lock_guard<std::mutex> lock(g.mutex);
+        std::unordered_map<const void*,
+            std::chrono::steady_clock::time_point>::iterator i =
+                g.sampled.find(p);
+        if (i != g.sampled.end()) {
+            t = i->second;
+            g.sampled.erase(i);
+        }
+    }
+}
+
+template<class Tag>
+inline void
+stats_mark(const void* p, std::chrono::steady_clock::time_point t)
+{
+    if (detail::stats_sampled(p)) {
+        stats_global& g = detail::stats_state<Tag>();
+        std::lock_guard<std::mutex> lock(g.mutex);
+#if !defined(BOOST_NO_EXCEPTIONS)
+        try {
+            g.sampled[p] = t;
+        } catch (...) { }
+#else
+        g.sampled[p] = t;
+#endif
+    }
+}
+
+} /* detail */
+
+template<class A, class Tag = void>
+struct stats_adaptor
+    : A {
+    template<class U>
+    struct rebind {
+        typedef stats_adaptor<typename allocator_rebind<A, U>::type,
+            Tag> other;
+    };
+
+    stats_adaptor()
+        : A() { }
+
+    template<class U>
+    stats_adaptor(U&& u) noexcept
+        : A(std::forward<U>(u)) { }
+
+    template<class U>
+    stats_adaptor(const stats_adaptor<U, Tag>& u) noexcept
+        : A(static_cast<const U&>(u)) { }
+
+    typename allocator_pointer<A>::type
+    allocate(typename allocator_size_type<A>::type n) {
+        typename allocator_pointer<A>::type p =
+            boost::allocator_allocate(static_cast<A&>(*this), n);
+        detail::stats_allocate<Tag>(boost::to_address(p),
+            static_cast<boost::uint64_t>(n) *
+                sizeof(typename allocator_value_type<A>::type));
+        return p;
+    }
+
+    allocation_result<typename allocator_pointer<A>::type,
+        typename allocator_size_type<A>::type>
+    allocate_at_least(typename allocator_size_type<A>::type n) {
+        allocation_result<typename allocator_pointer<A>::type,
+            typename allocator_size_type<A>::type> r =
+                boost::allocator_allocate_at_least(static_cast<A&>(*this), n);
+        detail::stats_allocate<Tag>(boost::to_address(r.ptr),
+            static_cast<boost::uint64_t>(r.count) *
+                sizeof(typename allocator_value_type<A>::type));
+        return r;
+    }
+
+    bool expand(typename allocator_pointer<A>::type p,
+        typename allocator_size_type<A>::type n,
+        typename allocator_size_type<A>::type m) {
+        if (!boost::allocator_expand(static_cast<A&>(*this), p, n, m)) {
+            return false;
+        }
+        detail::stats_expand<Tag>(static_cast<boost::uint64_t>(n) *
+            sizeof(typename allocator_value_type<A>::type),
+                static_cast<boost::uint64_t>(m) *
+                    sizeof(typename allocator_value_type<A>::type));
+        return true;
+    }
+
+    template<class B = A>
+    auto reallocate(typename allocator_pointer<A>::type p,
+        typename allocator_size_type<A>::type n,
+        typename allocator_size_type<A>::type m)
+    -> decltype(std::declval<B&>().reallocate(p, n, m)) {
+        std::chrono::steady_clock::time_point t =
+            std::chrono::steady_clock::now();
+        detail::stats_unmark<Tag>(boost::to_address(p), t);
+        typename allocator_pointer<A>::type q =
+            static_cast<A&>(*this).reallocate(p, n, m);
+        detail::stats_expand<Tag>(static_cast<boost::uint64_t>(n) *
+            sizeof(typename allocator_value_type<A>::type),
+                static_cast<boost::uint64_t>(m) *
+                    sizeof(typename allocator_value_type<A>::type));
+        detail::stats_mark<Tag>(boost::to_address(q), t);
+        return q;
+    }
+
+    void deallocate(typename allocator_pointer<A>::type p,
+        typename allocator_size_type<A>::type n) {
+        detail::stats_deallocate<Tag>(boost::to_address(p),
+            static_cast<boost::uint64_t>(n) *
+                sizeof(typename allocator_value_type<A>::type));
+        boost::allocator_deallocate(static_cast<A&>(*this), p, n);
+    }
+};
+
+template<class T, class U, class Tag>
+inline bool
+operator==(const stats_adaptor<T, Tag>& lhs,
+    const stats_adaptor<U, Tag>& rhs) noexcept
+{
+    return static_cast<const T&>(lhs) == static_cast<const U&>(rhs);
+}
+
+template<class T, class U, class Tag>
+inline bool
+operator!=(const stats_adaptor<T, Tag>& lhs,
+    const stats_adaptor<U, Tag>& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+template<class A>
+inline stats_adaptor<A>
+stats_adapt(const A& a) noexcept
+{
+    return stats_adaptor<A>(a);
+}
+
+template<class Tag = void>
+inline allocator_stats
+stats_snapshot()
+{
+    detail::stats_global& g = detail::stats_state<Tag>();
+    std::lock_guard<std::mutex> lock(g.mutex);
+    allocator_stats s = g.totals;
+    for (detail::stats_slot* p = g.slots; p; p = p->next) {
+        detail::stats_merge(s, *p);
+    }
+    boost::int64_t b = g.peak.load(std::memory_order_relaxed);
+    s.peak_bytes = b > 0 && static_cast<boost::uint64_t>(b) > s.bytes() ?
+        static_cast<boost::uint64_t>(b) : s.bytes();
+    return s;
+}
+
+template<class C, class T>
+inline std::basic_ostream<C, T>&
+operator<<(std::basic_ostream<C, T>& os, const allocator_stats& s)
+{
+    os << "allocations: " << s.allocations << '\n'
+        << "deallocations: " << s.deallocations << '\n'
+        << "bytes allocated: " << s.bytes_allocated << '\n'
+        << "bytes deallocated: " << s.bytes_deallocated << '\n'
+        << "bytes in use: " << s.bytes() << '\n'
+        << "peak bytes in use: " << s.peak_bytes << '\n'
+        << "sizes in bytes:\n";
+    for (std::size_t i = 0; i < allocator_stats::buckets; ++i) {
+        if (s.sizes[i] != 0) {
+            os << "  [" << (i == 0 ? 0 : boost::uint64_t(1) << (i - 1))
+                << ", " << (boost::uint64_t(1) << i) << "): "
+                << s.sizes[i] << '\n';
+        }
+    }
+    os << "sampled lifetimes in nanoseconds:\n";
+    for (std::size_t i = 0; i < allocator_stats::buckets; ++i) {
+        if (s.lifetimes[i] != 0) {
+            os << "  [" << (i == 0 ? 0 : boost::uint64_t(1) << (i - 1))
+                << ", " << (boost::uint64_t(1) << i) << "): "
+                << s.lifetimes[i] << '\n';
+        }
+    }
+    return os;
+}
+
+} /* boost */
+
+#endif
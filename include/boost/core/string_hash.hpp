@@ -0,0 +1,292 @@
+#ifndef BOOST_CORE_STRING_HASH_HPP_INCLUDED
+#define BOOST_CORE_STRING_HASH_HPP_INCLUDED
+
+// MS compatible compilers support #pragma once
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+// boost::core::string_hash( string_view sv, uint64_t seed = 0 )
+// boost::core::string_view_hash
+//
+// A self-contained 64 bit hash function for strings that reads eight
+// bytes at a time, derived from Wang Yi's public domain wyhash (final
+// version 4), https://github.com/wangyi-fudan/wyhash
+//
+// The result does not depend on the endianness of the platform, and is
+// the same at compile time and at runtime.
+//
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/detail/string_view.hpp>
+#include <boost/core/bit.hpp>
+#include <boost/core/detail/is_constant_evaluated.hpp>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <cstddef>
+#include <cstring>
+
+#if defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+# include <intrin.h>
+# pragma intrinsic(_umul128)
+#endif
+
+namespace boost
+{
+namespace core
+{
+namespace detail
+{
+
+// 64x64 -> 128 bit multiplication, a := low half, b := high half
+
+BOOST_CXX14_CONSTEXPR inline void hash_mum_portable( boost::uint64_t& a, boost::uint64_t& b ) BOOST_NOEXCEPT
+{
+    boost::uint64_t const ha = a >> 32, hb = b >> 32, la = static_cast<boost::uint32_t>( a ), lb = static_cast<boost::uint32_t>( b );
+
+    boost::uint64_t const rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+
+    boost::uint64_t const t = rl + ( rm0 << 32 );
+    boost::uint64_t c = t < rl;
+
+    boost::uint64_t const lo = t + ( rm1 << 32 );
+    c += lo < t;
+
+    a = lo;
+    b = rh + ( rm0 >> 32 ) + ( rm1 >> 32 ) + c;
+}
+
+BOOST_CXX14_CONSTEXPR inline void hash_mum( boost::uint64_t& a, boost::uint64_t& b ) BOOST_NOEXCEPT
+{
+#if defined(BOOST_HAS_INT128)
+
+    boost::uint128_type r = static_cast<boost::uint128_type>( a ) * b;
+
+    a = static_cast<boost::uint64_t>( r );
+    b = static_cast<boost::uint64_t>( r >> 64 );
+
+#elif defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__) && defined(BOOST_CORE_HAS_BUILTIN_IS_CONSTANT_EVALUATED)
+
+    if( detail::is_constant_evaluated() )
+    {
+        detail::hash_mum_portable( a, b );
+    }
+    else
+    {
+        a = _umul128( a, b, &b );
+    }
+
+#else
+
+    detail::hash_mum_portable( a, b );
+
+#endif
+}
+
+BOOST_CXX14_CONSTEXPR inline boost::uint64_t hash_mix( boost::uint64_t a, boost::uint64_t b ) BOOST_NOEXCEPT
+{
+    detail::hash_mum( a, b );
+    return a ^ b;
+}
+
+// little endian loads
+//
+// The loads are assembled from bytes during constant evaluation, and
+// when constant evaluation cannot be detected; compilers merge these
+// into a single load. At runtime, memcpy is used on little endian
+// platforms.
+
+BOOST_CXX14_CONSTEXPR inline boost::uint64_t hash_read64( char const* p ) BOOST_NOEXCEPT
+{
+#if defined(BOOST_CORE_HAS_BUILTIN_IS_CONSTANT_EVALUATED) || defined(BOOST_NO_CXX14_CONSTEXPR)
+
+    if( boost::core::endian::native == boost::core::endian::little && !detail::is_constant_evaluated() )
+    {
+        boost::uint64_t r = 0;
+        std::memcpy( &r, p, 8 );
+        return r;
+    }
+
+#endif
+
+    return
+        static_cast<boost::uint64_t>( static_cast<unsigned char>( p[ 0 ] ) ) |
+        static_cast<boost::uint64_t>( static_cast<unsigned char>( p[ 1 ] ) ) << 8 |
+        static_cast<boost::uint64_t>( static_cast<unsigned char>( p[ 2 ] ) ) << 16 |
+        static_cast<boost::uint64_t>( static_cast<unsigned char>( p[ 3 ] ) ) << 24 |
+        static_cast<boost::uint64_t>( static_cast<unsigned char>( p[ 4 ] ) ) << 32 |
+        static_cast<boost::uint64_t>( static_cast<unsigned char>( p[ 5 ] ) ) << 40 |
+        static_cast<boost::uint64_t>( static_cast<unsigned char>( p[ 6 ] ) ) << 48 |
+        static_cast<boost::uint64_t>( static_cast<unsigned char>( p[ 7 ] ) ) << 56;
+}
+
+BOOST_CXX14_CONSTEXPR inline boost::uint64_t hash_read32( char const* p ) BOOST_NOEXCEPT
+{
+#if defined(BOOST_CORE_HAS_BUILTIN_IS_CONSTANT_EVALUATED) || defined(BOOST_NO_CXX14_CONSTEXPR)
+
+    if( boost::core::endian::native == boost::core::endian::little && !detail::is_constant_evaluated() )
+    {
+        boost::uint32_t r = 0;
+        std::memcpy( &r, p, 4 );
+        return r;
+    }
+
+#endif
+
+    return
+        static_cast<boost::uint64_t>( static_cast<unsigned char>( p[ 0 ] ) ) |
+        static_cast<boost::uint64_t>( static_cast<unsigned char>( p[ 1 ] ) ) << 8 |
+        static_cast<boost::uint64_t>( static_cast<unsigned char>( p[ 2 ] ) ) << 16 |
+        static_cast<boost::uint64_t>( static_cast<unsigned char>( p[ 3 ] ) ) << 24;
+}
+
+BOOST_CXX14_CONSTEXPR inline boost::uint64_t hash_read8( char const* p ) BOOST_NOEXCEPT
+{
+    return static_cast<unsigned char>( *p );
+}
+
+// ASCII case folding of the bytes of a word, for the case-insensitive
+// hash in string_icase.hpp; the high bit of a byte is set in `ge_a` for
+// the bytes >= 'A', and in `gt_z` for the bytes > 'Z'
+
+BOOST_CXX14_CONSTEXPR inline boost::uint64_t hash_fold_ascii( boost::uint64_t x ) BOOST_NOEXCEPT
+{
+    boost::uint64_t const m7 = ( boost::uint64_t( 0x7f7f7f7fu ) << 32 ) + 0x7f7f7f7fu;
+    boost::uint64_t const m1 = ( boost::uint64_t( 0x01010101u ) << 32 ) + 0x01010101u;
+
+    boost::uint64_t const h = x & m7;
+
+    boost::uint64_t const ge_a = h + m1 * ( 0x80 - 'A' );
+    boost::uint64_t const gt_z = h + m1 * ( 0x7F - 'Z' );
+
+    boost::uint64_t const upper = ~x & ( ge_a ^ gt_z ) & ~m7;
+
+    return x | ( upper >> 2 );
+}
+
+template<bool Fold> BOOST_CXX14_CONSTEXPR boost::uint64_t hash_fold( boost::uint64_t x ) BOOST_NOEXCEPT
+{
+    return Fold? detail::hash_fold_ascii( x ): x;
+}
+
+template<bool Fold> BOOST_CXX14_CONSTEXPR boost::uint64_t hash_load64( char const* p ) BOOST_NOEXCEPT
+{
+    return detail::hash_fold<Fold>( detail::hash_read64( p ) );
+}
+
+template<bool Fold> BOOST_CXX14_CONSTEXPR boost::uint64_t hash_load32( char const* p ) BOOST_NOEXCEPT
+{
+    return detail::hash_fold<Fold>( detail::hash_read32( p ) );
+}
+
+template<bool Fold> BOOST_CXX14_CONSTEXPR boost::uint64_t hash_load8( char const* p ) BOOST_NOEXCEPT
+{
+    return detail::hash_fold<Fold>( detail::hash_read8( p ) );
+}
+
+// Fold = true hashes the characters as if converted to ASCII lower case
+
+template<bool Fold> BOOST_CXX14_CONSTEXPR boost::uint64_t hash_bytes( char const* p, std::size_t n, boost::uint64_t seed ) BOOST_NOEXCEPT
+{
+    boost::uint64_t const s0 = ( boost::uint64_t( 0x2d358dccu ) << 32 ) + 0xaa6c78a5u;
+    boost::uint64_t const s1 = ( boost::uint64_t( 0x8bb84b93u ) << 32 ) + 0x962eacc9u;
+    boost::uint64_t const s2 = ( boost::uint64_t( 0x4b33a62eu ) << 32 ) + 0xd433d4a3u;
+    boost::uint64_t const s3 = ( boost::uint64_t( 0x4d5a2da5u ) << 32 ) + 0x1de1aa47u;
+
+    seed ^= detail::hash_mix( seed ^ s0, s1 );
+
+    boost::uint64_t a = 0, b = 0;
+
+    if( n <= 16 )
+    {
+        if( n >= 4 )
+        {
+            std::size_t const k = ( n >> 3 ) << 2;
+
+            a = ( detail::hash_load32<Fold>( p ) << 32 ) | detail::hash_load32<Fold>( p + k );
+            b = ( detail::hash_load32<Fold>( p + n - 4 ) << 32 ) | detail::hash_load32<Fold>( p + n - 4 - k );
+        }
+        else if( n > 0 )
+        {
+            a = detail::hash_load8<Fold>( p ) << 16 | detail::hash_load8<Fold>( p + ( n >> 1 ) ) << 8 | detail::hash_load8<Fold>( p + n - 1 );
+        }
+    }
+    else
+    {
+        std::size_t i = n;
+
+        if( i > 48 )
+        {
+            // three independent lanes of 16 bytes each
+
+            boost::uint64_t see1 = seed, see2 = seed;
+
+            do
+            {
+                seed = detail::hash_mix( detail::hash_load64<Fold>( p ) ^ s1, detail::hash_load64<Fold>( p + 8 ) ^ seed );
+                see1 = detail::hash_mix( detail::hash_load64<Fold>( p + 16 ) ^ s2, detail::hash_load64<Fold>( p + 24 ) ^ see1 );
+                see2 = detail::hash_mix( detail::hash_load64<Fold>( p + 32 ) ^ s3, detail::hash_load64<Fold>( p + 40 ) ^ see2 );
+
+                p += 48;
+                i -= 48;
+            }
+            while( i > 48 );
+
+            seed ^= see1 ^ see2;
+        }
+
+        while( i > 16 )
+        {
+            seed = detail::hash_mix( detail::hash_load64<Fold>( p ) ^ s1, detail::hash_load64<Fold>( p + 8 ) ^ seed );
+
+            p += 16;
+            i -= 16;
+        }
+
+        a = detail::hash_load64<Fold>( p + i - 16 );
+        b = detail::hash_load64<Fold>( p + i - 8 );
+    }
+
+    a ^= s1;
+    b ^= seed;
+
+    detail::hash_mum( a, b );
+
+    return detail::hash_mix( a ^ s0 ^ n, b ^ s1 );
+}
+
+} // namespace detail
+
+// string_hash is constexpr, and gives the same value during constant
+// evaluation as at runtime, so that it can be used in case labels and
+// in precomputed hash tables. (Constructing a string_view from a string
+// literal in a constant expression requires C++17, or a compiler that
+// supports __builtin_is_constant_evaluated.)
+
+BOOST_CXX14_CONSTEXPR inline boost::uint64_t string_hash( string_view sv, boost::uint64_t seed = 0 ) BOOST_NOEXCEPT
+{
+    return detail::hash_bytes<false>( sv.data(), sv.size(), seed );
+}
+
+// A hash function object for unordered containers with string keys.
+// It is transparent, so that containers supporting heterogeneous
+// lookup can be searched with a string_view, a std::string or a
+// string literal without constructing a key.
+
+struct string_view_hash
+{
+    typedef void is_transparent;
+
+    BOOST_CXX14_CONSTEXPR std::size_t operator()( string_view sv ) const BOOST_NOEXCEPT
+    {
+        return static_cast<std::size_t>( boost::core::string_hash( sv ) );
+    }
+};
+
+} // namespace core
+} // namespace boost
+
+#endif  // #ifndef BOOST_CORE_STRING_HASH_HPP_INCLUDED
@@ -0,0 +1,276 @@
+#ifndef BOOST_CORE_STRING_ICASE_HPP_INCLUDED
+#define BOOST_CORE_STRING_ICASE_HPP_INCLUDED
+
+// MS compatible compilers support #pragma once
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+// boost::core::iequals( string_view s1, string_view s2 )
+// boost::core::istarts_with( string_view s, string_view prefix )
+// boost::core::iends_with( string_view s, string_view suffix )
+// boost::core::ifind( string_view s, string_view needle, size_t pos = 0 )
+// boost::core::string_ihash( string_view sv, uint64_t seed = 0 )
+// boost::core::string_view_ihash
+// boost::core::string_view_iequal_to
+//
+// ASCII case-insensitive comparison, search and hashing of strings,
+// without allocation; only the letters A-Z and a-z are folded
+//
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/detail/string_view.hpp>
+#include <boost/core/string_hash.hpp>
+#include <boost/core/bit.hpp>
+#include <boost/core/detail/is_constant_evaluated.hpp>
+#include <boost/core/detail/simd.hpp>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <cstddef>
+
+namespace boost
+{
+namespace core
+{
+namespace detail
+{
+
+BOOST_CONSTEXPR inline char icase_lower( char c ) BOOST_NOEXCEPT
+{
+    return c >= 'A' && c <= 'Z'? static_cast<char>( c + ( 'a' - 'A' ) ): c;
+}
+
+BOOST_CXX14_CONSTEXPR inline bool icase_equal_scalar( char const* p, char const* q, std::size_t n ) BOOST_NOEXCEPT
+{
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        if( detail::icase_lower( p[ i ] ) != detail::icase_lower( q[ i ] ) ) return false;
+    }
+
+    return true;
+}
+
+// requires n > 0
+
+BOOST_CXX14_CONSTEXPR inline std::size_t icase_find_scalar( char const* p_, std::size_t n_, char const* s, std::size_t pos, std::size_t n ) BOOST_NOEXCEPT
+{
+    char const first = detail::icase_lower( s[ 0 ] );
+
+    for( std::size_t i = pos; i + n <= n_; ++i )
+    {
+        if( detail::icase_lower( p_[ i ] ) == first && detail::icase_equal_scalar( p_ + i + 1, s + 1, n - 1 ) ) return i;
+    }
+
+    return static_cast<std::size_t>( -1 );
+}
+
+#if defined(BOOST_CORE_SV_SIMD)
+
+// Folding a block sets bit 5 of the bytes in 'A'..'Z'. The comparisons
+// are signed, so the bytes >= 0x80 are never in range.
+
+inline __m128i icase_fold( __m128i x ) BOOST_NOEXCEPT
+{
+    __m128i const upper = _mm_and_si128( _mm_cmpgt_epi8( x, _mm_set1_epi8( 'A' - 1 ) ), _mm_cmplt_epi8( x, _mm_set1_epi8( 'Z' + 1 ) ) );
+    return _mm_or_si128( x, _mm_and_si128( upper, _mm_set1_epi8( 0x20 ) ) );
+}
+
+#if defined(BOOST_CORE_AVX2)
+
+inline __m256i icase_fold( __m256i x ) BOOST_NOEXCEPT
+{
+    __m256i const upper = _mm256_andnot_si256( _mm256_cmpgt_epi8( x, _mm256_set1_epi8( 'Z' ) ), _mm256_cmpgt_epi8( x, _mm256_set1_epi8( 'A' - 1 ) ) );
+    return _mm256_or_si256( x, _mm256_and_si256( upper, _mm256_set1_epi8( 0x20 ) ) );
+}
+
+#endif
+
+inline bool icase_equal_simd( char const* p, char const* q, std::size_t n ) BOOST_NOEXCEPT
+{
+    std::size_t i = 0;
+
+#if defined(BOOST_CORE_AVX2)
+
+    for( ; i + 32 <= n; i += 32 )
+    {
+        __m256i const x = detail::icase_fold( _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + i ) ) );
+        __m256i const y = detail::icase_fold( _mm256_loadu_si256( reinterpret_cast<__m256i const*>( q + i ) ) );
+
+        if( _mm256_movemask_epi8( _mm256_cmpeq_epi8( x, y ) ) != -1 ) return false;
+    }
+
+#endif
+
+    for( ; i + 16 <= n; i += 16 )
+    {
+        __m128i const x = detail::icase_fold( _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + i ) ) );
+        __m128i const y = detail::icase_fold( _mm_loadu_si128( reinterpret_cast<__m128i const*>( q + i ) ) );
+
+        if( _mm_movemask_epi8( _mm_cmpeq_epi8( x, y ) ) != 0xFFFF ) return false;
+    }
+
+    return detail::icase_equal_scalar( p + i, q + i, n - i );
+}
+
+BOOST_CXX14_CONSTEXPR inline bool icase_equal( char const* p, char const* q, std::size_t n ) BOOST_NOEXCEPT
+{
+    if( !detail::is_constant_evaluated() )
+    {
+        return detail::icase_equal_simd( p, q, n );
+    }
+
+    return detail::icase_equal_scalar( p, q, n );
+}
+
+// As in string_view's find_simd, compares a block of positions against
+// the folded first and last character of the needle at once
+
+inline std::size_t icase_find_simd( char const* p_, std::size_t n_, char const* s, std::size_t pos, std::size_t n ) BOOST_NOEXCEPT
+{
+    std::size_t i = pos;
+
+#if defined(BOOST_CORE_AVX2)
+
+    {
+        __m256i const first = _mm256_set1_epi8( detail::icase_lower( s[ 0 ] ) );
+        __m256i const last = _mm256_set1_epi8( detail::icase_lower( s[ n - 1 ] ) );
+
+        for( ; i + n - 1 + 32 <= n_; i += 32 )
+        {
+            __m256i const b1 = detail::icase_fold( _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p_ + i ) ) );
+            __m256i const b2 = detail::icase_fold( _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p_ + i + n - 1 ) ) );
+
+            boost::uint32_t mask = static_cast<boost::uint32_t>( _mm256_movemask_epi8( _mm256_and_si256( _mm256_cmpeq_epi8( b1, first ), _mm256_cmpeq_epi8( b2, last ) ) ) );
+
+            while( mask != 0 )
+            {
+                std::size_t const j = i + boost::core::countr_zero( mask );
+
+                if( n <= 2 || detail::icase_equal_simd( p_ + j + 1, s + 1, n - 2 ) ) return j;
+
+                mask &= mask - 1;
+            }
+        }
+    }
+
+#endif
+
+    {
+        __m128i const first = _mm_set1_epi8( detail::icase_lower( s[ 0 ] ) );
+        __m128i const last = _mm_set1_epi8( detail::icase_lower( s[ n - 1 ] ) );
+
+        for( ; i + n - 1 + 16 <= n_; i += 16 )
+        {
+            __m128i const b1 = detail::icase_fold( _mm_loadu_si128( reinterpret_cast<__m128i const*>( p_ + i ) ) );
+            __m128i const b2 = detail::icase_fold( _mm_loadu_si128( reinterpret_cast<__m128i const*>( p_ + i + n - 1 ) ) );
+
+            boost::uint32_t mask = static_cast<boost::uint32_t>( _mm_movemask_epi8( _mm_and_si128( _mm_cmpeq_epi8( b1, first ), _mm_cmpeq_epi8( b2, last ) ) ) );
+
+            while( mask != 0 )
+            {
+                std::size_t const j = i + boost::core::countr_zero( mask );
+
+                if( n <= 2 || detail::icase_equal_simd( p_ + j + 1, s + 1, n - 2 ) ) return j;
+
+                mask &= mask - 1;
+            }
+        }
+    }
+
+    return detail::icase_find_scalar( p_, n_, s, i, n );
+}
+
+BOOST_CXX14_CONSTEXPR inline std::size_t icase_find( char const* p_, std::size_t n_, char const* s, std::size_t pos, std::size_t n ) BOOST_NOEXCEPT
+{
+    if( !detail::is_constant_evaluated() )
+    {
+        return detail::icase_find_simd( p_, n_, s, pos, n );
+    }
+
+    return detail::icase_find_scalar( p_, n_, s, pos, n );
+}
+
+#else
+
+BOOST_CXX14_CONSTEXPR inline bool icase_equal( char const* p, char const* q, std::size_t n ) BOOST_NOEXCEPT
+{
+    return detail::icase_equal_scalar( p, q, n );
+}
+
+BOOST_CXX14_CONSTEXPR inline std::size_t icase_find( char const* p_, std::size_t n_, char const* s, std::size_t pos, std::size_t n ) BOOST_NOEXCEPT
+{
+    return detail::icase_find_scalar( p_, n_, s, pos, n );
+}
+
+#endif // #if defined(BOOST_CORE_SV_SIMD)
+
+} // namespace detail
+
+// comparison
+
+BOOST_CXX14_CONSTEXPR inline bool iequals( string_view s1, string_view s2 ) BOOST_NOEXCEPT
+{
+    return s1.size() == s2.size() && detail::icase_equal( s1.data(), s2.data(), s1.size() );
+}
+
+BOOST_CXX14_CONSTEXPR inline bool istarts_with( string_view s, string_view prefix ) BOOST_NOEXCEPT
+{
+    return s.size() >= prefix.size() && detail::icase_equal( s.data(), prefix.data(), prefix.size() );
+}
+
+BOOST_CXX14_CONSTEXPR inline bool iends_with( string_view s, string_view suffix ) BOOST_NOEXCEPT
+{
+    return s.size() >= suffix.size() && detail::icase_equal( s.data() + s.size() - suffix.size(), suffix.data(), suffix.size() );
+}
+
+// search; returns the lowest position i >= pos at which `needle` occurs
+// in `s`, ignoring case, or string_view::npos
+
+BOOST_CXX14_CONSTEXPR inline std::size_t ifind( string_view s, string_view needle, std::size_t pos = 0 ) BOOST_NOEXCEPT
+{
+    std::size_t const n = needle.size();
+
+    if( pos > s.size() || n > s.size() - pos ) return string_view::npos;
+    if( n == 0 ) return pos;
+
+    return detail::icase_find( s.data(), s.size(), needle.data(), pos, n );
+}
+
+// hashing; string_ihash( s ) == string_hash( s' ), where s' is s with
+// the letters A-Z converted to lower case, so that strings that compare
+// equal under iequals have the same hash value
+
+BOOST_CXX14_CONSTEXPR inline boost::uint64_t string_ihash( string_view sv, boost::uint64_t seed = 0 ) BOOST_NOEXCEPT
+{
+    return detail::hash_bytes<true>( sv.data(), sv.size(), seed );
+}
+
+// function objects for unordered containers with case-insensitive keys
+
+struct string_view_ihash
+{
+    typedef void is_transparent;
+
+    BOOST_CXX14_CONSTEXPR std::size_t operator()( string_view sv ) const BOOST_NOEXCEPT
+    {
+        return static_cast<std::size_t>( boost::core::string_ihash( sv ) );
+    }
+};
+
+struct string_view_iequal_to
+{
+    typedef void is_transparent;
+
+    BOOST_CXX14_CONSTEXPR bool operator()( string_view s1, string_view s2 ) const BOOST_NOEXCEPT
+    {
+        return boost::core::iequals( s1, s2 );
+    }
+};
+
+} // namespace core
+} // namespace boost
+
+#endif  // #ifndef BOOST_CORE_STRING_ICASE_HPP_INCLUDED
@@ -0,0 +1,203 @@
+#ifndef BOOST_CORE_STRING_SEARCHER_HPP_INCLUDED
+#define BOOST_CORE_STRING_SEARCHER_HPP_INCLUDED
+
+// MS compatible compilers support #pragma once
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+// boost::core::basic_horspool_searcher<Ch>
+// boost::core::basic_reverse_horspool_searcher<Ch>
+//
+// Boyer-Moore-Horspool substring search over basic_string_view,
+// for a needle that is searched for in many haystacks
+//
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/detail/string_view.hpp>
+#include <boost/config.hpp>
+#include <string>
+#include <cstddef>
+
+namespace boost
+{
+namespace core
+{
+namespace detail
+{
+
+// Characters are mapped to one of 256 skip table entries by their low
+// byte. Characters that share an entry get the smallest of their shifts,
+// which keeps the search correct for wide character types.
+
+template<class Ch> BOOST_CONSTEXPR inline std::size_t hs_index( Ch ch ) BOOST_NOEXCEPT
+{
+    return static_cast<std::size_t>( static_cast<typename sv_to_uchar<Ch>::type>( ch ) ) & 0xFF;
+}
+
+} // namespace detail
+
+// basic_horspool_searcher
+
+template<class Ch> class basic_horspool_searcher
+{
+private:
+
+    basic_string_view<Ch> s_;
+    std::size_t skip_[ 256 ];
+
+public:
+
+    typedef std::size_t size_type;
+
+    BOOST_STATIC_CONSTEXPR size_type npos = static_cast<size_type>( -1 );
+
+    // the searcher refers to the characters of `s`, which must
+    // remain valid for as long as the searcher is used
+
+    BOOST_CXX14_CONSTEXPR explicit basic_horspool_searcher( basic_string_view<Ch> s ) BOOST_NOEXCEPT: s_( s ), skip_()
+    {
+        std::size_t const m = s.size();
+
+        for( std::size_t i = 0; i < 256; ++i )
+        {
+            skip_[ i ] = m;
+        }
+
+        for( std::size_t i = 0; i + 1 < m; ++i )
+        {
+            skip_[ detail::hs_index( s[ i ] ) ] = m - 1 - i;
+        }
+    }
+
+    BOOST_CONSTEXPR basic_string_view<Ch> needle() const BOOST_NOEXCEPT
+    {
+        return s_;
+    }
+
+    // returns the lowest position i >= pos at which the needle occurs
+    // in `str`, or npos
+
+    BOOST_CXX14_CONSTEXPR size_type find( basic_string_view<Ch> str, size_type pos = 0 ) const BOOST_NOEXCEPT
+    {
+        std::size_t const n = str.size();
+        std::size_t const m = s_.size();
+
+        if( pos > n || m > n - pos ) return npos;
+        if( m == 0 ) return pos;
+
+        Ch const* p = str.data();
+        Ch const* s = s_.data();
+
+        Ch const last = s[ m - 1 ];
+
+        for( std::size_t i = pos; i <= n - m; )
+        {
+            Ch const ch = p[ i + m - 1 ];
+
+            if( ch == last && std::char_traits<Ch>::compare( p + i, s, m - 1 ) == 0 ) return i;
+
+            i += skip_[ detail::hs_index( ch ) ];
+        }
+
+        return npos;
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+template<class Ch> BOOST_CONSTEXPR_OR_CONST std::size_t basic_horspool_searcher<Ch>::npos;
+#endif
+
+// basic_reverse_horspool_searcher
+
+template<class Ch> class basic_reverse_horspool_searcher
+{
+private:
+
+    basic_string_view<Ch> s_;
+    std::size_t skip_[ 256 ];
+
+public:
+
+    typedef std::size_t size_type;
+
+    BOOST_STATIC_CONSTEXPR size_type npos = static_cast<size_type>( -1 );
+
+    // the searcher refers to the characters of `s`, which must
+    // remain valid for as long as the searcher is used
+
+    BOOST_CXX14_CONSTEXPR explicit basic_reverse_horspool_searcher( basic_string_view<Ch> s ) BOOST_NOEXCEPT: s_( s ), skip_()
+    {
+        std::size_t const m = s.size();
+
+        for( std::size_t i = 0; i < 256; ++i )
+        {
+            skip_[ i ] = m;
+        }
+
+        for( std::size_t i = m; i > 1; --i )
+        {
+            skip_[ detail::hs_index( s[ i - 1 ] ) ] = i - 1;
+        }
+    }
+
+    BOOST_CONSTEXPR basic_string_view<Ch> needle() const BOOST_NOEXCEPT
+    {
+        return s_;
+    }
+
+    // returns the highest position i <= pos at which the needle occurs
+    // in `str`, or npos
+
+    BOOST_CXX14_CONSTEXPR size_type rfind( basic_string_view<Ch> str, size_type pos = npos ) const BOOST_NOEXCEPT
+    {
+        std::size_t const n = str.size();
+        std::size_t const m = s_.size();
+
+        if( m > n ) return npos;
+
+        if( pos > n - m )
+        {
+            pos = n - m;
+        }
+
+        if( m == 0 ) return pos;
+
+        Ch const* p = str.data();
+        Ch const* s = s_.data();
+
+        Ch const first = s[ 0 ];
+
+        for( std::size_t i = pos; ; )
+        {
+            Ch const ch = p[ i ];
+
+            if( ch == first && std::char_traits<Ch>::compare( p + i + 1, s + 1, m - 1 ) == 0 ) return i;
+
+            std::size_t const k = skip_[ detail::hs_index( ch ) ];
+
+            if( k > i ) break;
+
+            i -= k;
+        }
+
+        return npos;
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+template<class Ch> BOOST_CONSTEXPR_OR_CONST std::size_t basic_reverse_horspool_searcher<Ch>::npos;
+#endif
+
+// typedef names
+
+typedef basic_horspool_searcher<char> horspool_searcher;
+typedef basic_reverse_horspool_searcher<char> reverse_horspool_searcher;
+
+} // namespace core
+} // namespace boost
+
+#endif  // #ifndef BOOST_CORE_STRING_SEARCHER_HPP_INCLUDED
@@ -0,0 +1,227 @@
+#ifndef BOOST_CORE_STRING_SPLIT_HPP_INCLUDED
+#define BOOST_CORE_STRING_SPLIT_HPP_INCLUDED
+
+// MS compatible compilers support #pragma once
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+// boost::core::split( string_view s, char d )
+// boost::core::split( string_view s, string_view d )
+// boost::core::split( string_view s, char_set const& d )
+//
+// A lazy forward range over the pieces of a string between
+// delimiters, as string_view; does not allocate
+//
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/detail/string_view.hpp>
+#include <boost/config.hpp>
+#include <iterator>
+#include <cstddef>
+
+namespace boost
+{
+namespace core
+{
+namespace detail
+{
+
+// split_find( s, pos, d ) returns the position of the next delimiter
+// at or after pos, or npos; split_size( d ) returns its length
+
+template<class Ch> BOOST_CXX14_CONSTEXPR std::size_t split_find( basic_string_view<Ch> s, std::size_t pos, Ch d ) BOOST_NOEXCEPT
+{
+    return s.find( d, pos );
+}
+
+template<class Ch> BOOST_CONSTEXPR std::size_t split_size( Ch ) BOOST_NOEXCEPT
+{
+    return 1;
+}
+
+template<class Ch> BOOST_CXX14_CONSTEXPR std::size_t split_find( basic_string_view<Ch> s, std::size_t pos, basic_string_view<Ch> d ) BOOST_NOEXCEPT
+{
+    // an empty delimiter does not split
+    return d.empty()? basic_string_view<Ch>::npos: s.find( d, pos );
+}
+
+template<class Ch> BOOST_CONSTEXPR std::size_t split_size( basic_string_view<Ch> d ) BOOST_NOEXCEPT
+{
+    return d.size();
+}
+
+BOOST_CXX14_CONSTEXPR inline std::size_t split_find( string_view s, std::size_t pos, char_set const& d ) BOOST_NOEXCEPT
+{
+    return s.find_first_of( d, pos );
+}
+
+BOOST_CONSTEXPR inline std::size_t split_size( char_set const& ) BOOST_NOEXCEPT
+{
+    return 1;
+}
+
+} // namespace detail
+
+// basic_split_range
+
+template<class Ch, class D> class basic_split_range
+{
+private:
+
+    basic_string_view<Ch> s_;
+    D d_;
+
+public:
+
+    class iterator
+    {
+    private:
+
+        basic_string_view<Ch> s_;
+        D d_;
+
+        // the current piece, s_.substr( pos_, n_ ); pos_ == npos at the end
+        std::size_t pos_;
+        std::size_t n_;
+
+        basic_string_view<Ch> v_;
+
+        BOOST_CXX14_CONSTEXPR void set_piece() BOOST_NOEXCEPT
+        {
+            std::size_t e = detail::split_find( s_, pos_, d_ );
+
+            if( e == basic_string_view<Ch>::npos )
+            {
+                e = s_.size();
+            }
+
+            n_ = e - pos_;
+            v_ = basic_string_view<Ch>( s_.data() + pos_, n_ );
+        }
+
+    public:
+
+        typedef basic_string_view<Ch> value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef value_type const* pointer;
+        typedef value_type const& reference;
+        typedef std::forward_iterator_tag iterator_category;
+
+        BOOST_CONSTEXPR iterator() BOOST_NOEXCEPT: s_(), d_(), pos_( basic_string_view<Ch>::npos ), n_( 0 ), v_()
+        {
+        }
+
+        // the begin iterator of the pieces of `s`
+
+        BOOST_CXX14_CONSTEXPR iterator( basic_string_view<Ch> s, D const& d ) BOOST_NOEXCEPT: s_( s ), d_( d ), pos_( 0 ), n_( 0 ), v_()
+        {
+            set_piece();
+        }
+
+        BOOST_CONSTEXPR reference operator*() const BOOST_NOEXCEPT
+        {
+            return v_;
+        }
+
+        BOOST_CONSTEXPR pointer operator->() const BOOST_NOEXCEPT
+        {
+            return &v_;
+        }
+
+        BOOST_CXX14_CONSTEXPR iterator& operator++() BOOST_NOEXCEPT
+        {
+            std::size_t const e = pos_ + n_;
+
+            if( e == s_.size() )
+            {
+                pos_ = basic_string_view<Ch>::npos;
+                n_ = 0;
+                v_ = basic_string_view<Ch>();
+            }
+            else
+            {
+                pos_ = e + detail::split_size( d_ );
+                set_piece();
+            }
+
+            return *this;
+        }
+
+        BOOST_CXX14_CONSTEXPR iterator operator++( int ) BOOST_NOEXCEPT
+        {
+            iterator r( *this );
+            ++*this;
+            return r;
+        }
+
+        BOOST_CONSTEXPR friend bool operator==( iterator const& it1, iterator const& it2 ) BOOST_NOEXCEPT
+        {
+            return it1.pos_ == it2.pos_;
+        }
+
+        BOOST_CONSTEXPR friend bool operator!=( iterator const& it1, iterator const& it2 ) BOOST_NOEXCEPT
+        {
+            return it1.pos_ != it2.pos_;
+        }
+    };
+
+    typedef iterator const_iterator;
+
+    BOOST_CONSTEXPR basic_split_range( basic_string_view<Ch> s, D const& d ) BOOST_NOEXCEPT: s_( s ), d_( d )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR iterator begin() const BOOST_NOEXCEPT
+    {
+        return iterator( s_, d_ );
+    }
+
+    BOOST_CONSTEXPR iterator end() const BOOST_NOEXCEPT
+    {
+        return iterator();
+    }
+};
+
+// split
+
+template<class Ch> BOOST_CONSTEXPR basic_split_range<Ch, Ch> split( basic_string_view<Ch> s, Ch d ) BOOST_NOEXCEPT
+{
+    return basic_split_range<Ch, Ch>( s, d );
+}
+
+template<class Ch> BOOST_CONSTEXPR basic_split_range<Ch, basic_string_view<Ch> > split( basic_string_view<Ch> s, basic_string_view<Ch> d ) BOOST_NOEXCEPT
+{
+    return basic_split_range<Ch, basic_string_view<Ch> >( s, d );
+}
+
+// overloads for char, so that arguments convertible to string_view
+// (std::string, string literals) can be passed
+
+BOOST_CONSTEXPR inline basic_split_range<char, char> split( string_view s, char d ) BOOST_NOEXCEPT
+{
+    return basic_split_range<char, char>( s, d );
+}
+
+BOOST_CONSTEXPR inline basic_split_range<char, string_view> split( string_view s, string_view d ) BOOST_NOEXCEPT
+{
+    return basic_split_range<char, string_view>( s, d );
+}
+
+BOOST_CONSTEXPR inline basic_split_range<char, string_view> split( string_view s, char const* d ) BOOST_NOEXCEPT
+{
+    return basic_split_range<char, string_view>( s, d );
+}
+
+BOOST_CONSTEXPR inline basic_split_range<char, char_set> split( string_view s, char_set const& d ) BOOST_NOEXCEPT
+{
+    return basic_split_range<char, char_set>( s, d );
+}
+
+} // namespace core
+} // namespace boost
+
+#endif  // #ifndef BOOST_CORE_STRING_SPLIT_HPP_INCLUDED
@@ -0,0 +1,261 @@
+#ifndef BOOST_CORE_UNIFORM_RANDOM_HPP_INCLUDED
+#define BOOST_CORE_UNIFORM_RANDOM_HPP_INCLUDED
+
+// MS compatible compilers support #pragma once
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+// boost::core::uniform_below( g, n )
+// boost::core::uniform_double( g )
+// boost::core::uniform_float( g )
+// boost::core::uniform_fill( g, span<uint64_t>, n )
+// boost::core::uniform_fill( g, span<double> )
+// boost::core::uniform_fill( g, span<float> )
+//
+// Uniformly distributed integers in [0, n) and floating point values
+// in [0, 1) from a generator of 64 bit values, such as splitmix64 or
+// the generators in <boost/core/xoshiro.hpp>.
+//
+// uniform_below uses the multiply and shift method of Daniel Lemire,
+// "Fast Random Integer Generation in an Interval", 2019, which is
+// free of modulo bias and only divides when a value is rejected.
+//
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/xoshiro.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <cstddef>
+
+#if !defined(BOOST_NO_CXX11_CONSTEXPR) && !defined(BOOST_NO_CXX11_DECLTYPE)
+# include <boost/core/span.hpp>
+# define BOOST_CORE_UNIFORM_RANDOM_HAS_SPAN
+#endif
+
+#if defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+# include <intrin.h>
+# pragma intrinsic(_umul128)
+#endif
+
+namespace boost
+{
+namespace core
+{
+namespace detail
+{
+
+// 64x64 -> 128 bit multiplication, returns the low half
+
+inline boost::uint64_t uniform_mul( boost::uint64_t a, boost::uint64_t b, boost::uint64_t& hi ) BOOST_NOEXCEPT
+{
+#if defined(BOOST_HAS_INT128)
+
+    boost::uint128_type const r = static_cast<boost::uint128_type>( a ) * b;
+
+    hi = static_cast<boost::uint64_t>( r >> 64 );
+    return static_cast<boost::uint64_t>( r );
+
+#elif defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+
+    return _umul128( a, b, &hi );
+
+#else
+
+    boost::uint64_t const ha = a >> 32, hb = b >> 32, la = static_cast<boost::uint32_t>( a ), lb = static_cast<boost::uint32_t>( b );
+
+    boost::uint64_t const rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+
+    boost::uint64_t const t = rl + ( rm0 << 32 );
+    boost::uint64_t c = t < rl;
+
+    boost::uint64_t const lo = t + ( rm1 << 32 );
+    c += lo < t;
+
+    hi = rh + ( rm0 >> 32 ) + ( rm1 >> 32 ) + c;
+    return lo;
+
+#endif
+}
+
+// values of 53 and 24 bits are converted through signed integers,
+// which is a single instruction on x86, and vectorizes for float
+
+inline double uniform_to_double( boost::uint64_t x ) BOOST_NOEXCEPT
+{
+    return static_cast<double>( static_cast<boost::int64_t>( x >> 11 ) ) * ( 1.0 / 9007199254740992.0 ); // 2^-53
+}
+
+inline float uniform_to_float( boost::uint64_t x ) BOOST_NOEXCEPT
+{
+    return static_cast<float>( static_cast<boost::int32_t>( x >> 40 ) ) * ( 1.0f / 16777216.0f ); // 2^-24
+}
+
+#if defined(BOOST_CORE_UNIFORM_RANDOM_HAS_SPAN)
+
+// raw values for the span functions, in blocks of uniform_block
+
+std::size_t const uniform_block = 64;
+
+template<class G> inline void uniform_generate( G& g, boost::uint64_t* p, std::size_t n )
+{
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        p[ i ] = g();
+    }
+}
+
+inline void uniform_generate( boost::core::xoshiro256ss& g, boost::uint64_t* p, std::size_t n ) BOOST_NOEXCEPT
+{
+    g.fill( span<boost::uint64_t>( p, n ) );
+}
+
+inline void uniform_generate( boost::core::xoroshiro128p& g, boost::uint64_t* p, std::size_t n ) BOOST_NOEXCEPT
+{
+    g.fill( span<boost::uint64_t>( p, n ) );
+}
+
+inline void uniform_generate( boost::core::xoshiro256ss_x4& g, boost::uint64_t* p, std::size_t n ) BOOST_NOEXCEPT
+{
+    g.fill( span<boost::uint64_t>( p, n ) );
+}
+
+#endif
+
+} // namespace detail
+
+// integer in [0, n), n > 0
+
+template<class G> boost::uint64_t uniform_below( G& g, boost::uint64_t n )
+{
+    BOOST_ASSERT( n != 0 );
+
+    boost::uint64_t hi = 0;
+    boost::uint64_t lo = detail::uniform_mul( g(), n, hi );
+
+    if( lo < n )
+    {
+        // 2^64 mod n; the values with lo below it are rejected
+
+        boost::uint64_t const t = ( ~n + 1 ) % n;
+
+        while( lo < t )
+        {
+            lo = detail::uniform_mul( g(), n, hi );
+        }
+    }
+
+    return hi;
+}
+
+// floating point values in [0, 1), from the upper 53 or 24 bits
+
+template<class G> double uniform_double( G& g )
+{
+    return detail::uniform_to_double( g() );
+}
+
+template<class G> float uniform_float( G& g )
+{
+    return detail::uniform_to_float( g() );
+}
+
+#if defined(BOOST_CORE_UNIFORM_RANDOM_HAS_SPAN)
+
+// the span functions draw the values in blocks, with the bulk fill of
+// the generator when it has one, and compute the rejection threshold
+// of uniform_below once
+
+template<class G> void uniform_fill( G& g, span<boost::uint64_t> s, boost::uint64_t n )
+{
+    BOOST_ASSERT( n != 0 );
+
+    boost::uint64_t const t = ( ~n + 1 ) % n;
+
+    boost::uint64_t* p = s.data();
+    std::size_t m = s.size();
+
+    boost::uint64_t tmp[ detail::uniform_block ];
+
+    while( m > 0 )
+    {
+        std::size_t const k = m < detail::uniform_block? m: detail::uniform_block;
+
+        detail::uniform_generate( g, tmp, k );
+
+        for( std::size_t i = 0; i < k; ++i )
+        {
+            boost::uint64_t hi = 0;
+            boost::uint64_t lo = detail::uniform_mul( tmp[ i ], n, hi );
+
+            while( lo < t )
+            {
+                lo = detail::uniform_mul( g(), n, hi );
+            }
+
+            p[ i ] = hi;
+        }
+
+        p += k;
+        m -= k;
+    }
+}
+
+template<class G> void uniform_fill( G& g, span<double> s )
+{
+    double* p = s.data();
+    std::size_t m = s.size();
+
+    boost::uint64_t tmp[ detail::uniform_block ];
+
+    while( m > 0 )
+    {
+        std::size_t const k = m < detail::uniform_block? m: detail::uniform_block;
+
+        detail::uniform_generate( g, tmp, k );
+
+        for( std::size_t i = 0; i < k; ++i )
+        {
+            p[ i ] = detail::uniform_to_double( tmp[ i ] );
+        }
+
+        p += k;
+        m -= k;
+    }
+}
+
+template<class G> void uniform_fill( G& g, span<float> s )
+{
+    float* p = s.data();
+    std::size_t m = s.size();
+
+    boost::uint64_t tmp[ detail::uniform_block ];
+
+    while( m > 0 )
+    {
+        std::size_t const k = m < detail::uniform_block? m: detail::uniform_block;
+
+        detail::uniform_generate( g, tmp, k );
+
+        for( std::size_t i = 0; i < k; ++i )
+        {
+            p[ i ] = detail::uniform_to_float( tmp[ i ] );
+        }
+
+        p += k;
+        m -= k;
+    }
+}
+
+#endif
+
+} // namespace core
+} // namespace boost
+
+#undef BOOST_CORE_UNIFORM_RANDOM_HAS_SPAN
+
+#endif  // #ifndef BOOST_CORE_UNIFORM_RANDOM_HPP_INCLUDED
@@ -0,0 +1,513 @@
+#ifndef BOOST_CORE_UTF8_HPP_INCLUDED
+#define BOOST_CORE_UTF8_HPP_INCLUDED
+
+// MS compatible compilers support #pragma once
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+// boost::core::utf8_is_valid( string_view s )
+// boost::core::utf8_find_invalid( string_view s )
+// boost::core::utf8_count( string_view s )
+//
+// UTF-8 validation and code point counting over string_view and,
+// when char8_t is available, u8string_view
+//
+// The SIMD validation (SSSE3, AVX2) is the "lookup" algorithm of
+// John Keiser and Daniel Lemire, "Validating UTF-8 In Less Than One
+// Instruction Per Byte", Software: Practice and Experience 51(5), 2021
+//
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/detail/string_view.hpp>
+#include <boost/core/bit.hpp>
+#include <boost/core/detail/is_constant_evaluated.hpp>
+#include <boost/core/detail/simd.hpp>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <cstddef>
+#include <cstring>
+
+namespace boost
+{
+namespace core
+{
+namespace detail
+{
+
+template<class Ch> BOOST_CONSTEXPR unsigned utf8_byte( Ch ch ) BOOST_NOEXCEPT
+{
+    return static_cast<unsigned char>( ch );
+}
+
+template<class Ch> BOOST_CONSTEXPR bool utf8_is_continuation( Ch ch ) BOOST_NOEXCEPT
+{
+    return ( detail::utf8_byte( ch ) & 0xC0 ) == 0x80;
+}
+
+// returns the length of the well-formed code unit sequence at p[ i ],
+// as defined by table 3-7 of the Unicode standard, or 0
+
+template<class Ch> BOOST_CXX14_CONSTEXPR std::size_t utf8_sequence_length( Ch const* p, std::size_t n, std::size_t i ) BOOST_NOEXCEPT
+{
+    unsigned const c = detail::utf8_byte( p[ i ] );
+
+    if( c < 0x80 ) return 1;
+
+    std::size_t m = 0;
+    unsigned lo = 0x80, hi = 0xBF;
+
+    if( c < 0xC2 )
+    {
+        return 0;
+    }
+    else if( c < 0xE0 )
+    {
+        m = 2;
+    }
+    else if( c < 0xF0 )
+    {
+        m = 3;
+
+        if( c == 0xE0 ) lo = 0xA0;
+        if( c == 0xED ) hi = 0x9F;
+    }
+    else if( c < 0xF5 )
+    {
+        m = 4;
+
+        if( c == 0xF0 ) lo = 0x90;
+        if( c == 0xF4 ) hi = 0x8F;
+    }
+    else
+    {
+        return 0;
+    }
+
+    if( n - i < m ) return 0;
+
+    unsigned const c1 = detail::utf8_byte( p[ i + 1 ] );
+    if( c1 < lo || c1 > hi ) return 0;
+
+    for( std::size_t j = 2; j < m; ++j )
+    {
+        if( !detail::utf8_is_continuation( p[ i + j ] ) ) return 0;
+    }
+
+    return m;
+}
+
+template<class Ch> BOOST_CXX14_CONSTEXPR std::size_t utf8_find_invalid_scalar( Ch const* p, std::size_t n, std::size_t i ) BOOST_NOEXCEPT
+{
+    while( i < n )
+    {
+        std::size_t const m = detail::utf8_sequence_length( p, n, i );
+
+        if( m == 0 ) return i;
+
+        i += m;
+    }
+
+    return static_cast<std::size_t>( -1 );
+}
+
+template<class Ch> BOOST_CXX14_CONSTEXPR std::size_t utf8_count_scalar( Ch const* p, std::size_t n ) BOOST_NOEXCEPT
+{
+    std::size_t r = 0;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        r += !detail::utf8_is_continuation( p[ i ] );
+    }
+
+    return r;
+}
+
+#if defined(BOOST_CORE_SV_SIMD)
+
+#if defined(BOOST_CORE_SSSE3)
+
+// Every block is classified with three nibble lookups, of the high and
+// low nibble of the previous byte and of the high nibble of the byte,
+// whose results are and-ed; a nonzero bit is an error, except for the
+// "two continuations" bit, which must be set exactly for the third and
+// fourth bytes of a sequence.
+
+#define BOOST_CORE_UTF8_TABLE_1HIGH \
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, \
+    static_cast<char>( 0x80 ), static_cast<char>( 0x80 ), static_cast<char>( 0x80 ), static_cast<char>( 0x80 ), \
+    0x21, 0x01, 0x15, 0x49
+
+#define BOOST_CORE_UTF8_TABLE_1LOW \
+    static_cast<char>( 0xE7 ), static_cast<char>( 0xA3 ), static_cast<char>( 0x83 ), static_cast<char>( 0x83 ), \
+    static_cast<char>( 0x8B ), static_cast<char>( 0xCB ), static_cast<char>( 0xCB ), static_cast<char>( 0xCB ), \
+    static_cast<char>( 0xCB ), static_cast<char>( 0xCB ), static_cast<char>( 0xCB ), static_cast<char>( 0xCB ), \
+    static_cast<char>( 0xCB ), static_cast<char>( 0xDB ), static_cast<char>( 0xCB ), static_cast<char>( 0xCB )
+
+#define BOOST_CORE_UTF8_TABLE_2HIGH \
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, \
+    static_cast<char>( 0xE6 ), static_cast<char>( 0xAE ), static_cast<char>( 0xBA ), static_cast<char>( 0xBA ), \
+    0x01, 0x01, 0x01, 0x01
+
+struct utf8_sse
+{
+    typedef __m128i type;
+
+    static std::size_t const size = 16;
+
+    static type load( char const* p ) BOOST_NOEXCEPT
+    {
+        return _mm_loadu_si128( reinterpret_cast<__m128i const*>( p ) );
+    }
+
+    static type zero() BOOST_NOEXCEPT
+    {
+        return _mm_setzero_si128();
+    }
+
+    static type or_( type x, type y ) BOOST_NOEXCEPT
+    {
+        return _mm_or_si128( x, y );
+    }
+
+    static bool is_ascii( type x ) BOOST_NOEXCEPT
+    {
+        return _mm_movemask_epi8( x ) == 0;
+    }
+
+    static bool is_zero( type x ) BOOST_NOEXCEPT
+    {
+        return _mm_movemask_epi8( _mm_cmpeq_epi8( x, _mm_setzero_si128() ) ) == 0xFFFF;
+    }
+
+    // the error bits of the block `x`, preceded by the block `prev`
+
+    static type check( type x, type prev ) BOOST_NOEXCEPT
+    {
+        __m128i const m0f = _mm_set1_epi8( 0x0F );
+
+        __m128i const prev1 = _mm_alignr_epi8( x, prev, 15 );
+        __m128i const prev2 = _mm_alignr_epi8( x, prev, 14 );
+        __m128i const prev3 = _mm_alignr_epi8( x, prev, 13 );
+
+        __m128i const b1h = _mm_shuffle_epi8( _mm_setr_epi8( BOOST_CORE_UTF8_TABLE_1HIGH ), _mm_and_si128( _mm_srli_epi16( prev1, 4 ), m0f ) );
+        __m128i const b1l = _mm_shuffle_epi8( _mm_setr_epi8( BOOST_CORE_UTF8_TABLE_1LOW ), _mm_and_si128( prev1, m0f ) );
+        __m128i const b2h = _mm_shuffle_epi8( _mm_setr_epi8( BOOST_CORE_UTF8_TABLE_2HIGH ), _mm_and_si128( _mm_srli_epi16( x, 4 ), m0f ) );
+
+        __m128i const sc = _mm_and_si128( _mm_and_si128( b1h, b1l ), b2h );
+
+        // bit 7 is set where two bytes back is a lead of three or more
+        // bytes, or three bytes back is a lead of four bytes
+
+        __m128i const must23 = _mm_or_si128( _mm_subs_epu8( prev2, _mm_set1_epi8( 0xE0 - 0x80 ) ), _mm_subs_epu8( prev3, _mm_set1_epi8( 0xF0 - 0x80 ) ) );
+
+        return _mm_xor_si128( _mm_and_si128( must23, _mm_set1_epi8( static_cast<char>( 0x80 ) ) ), sc );
+    }
+
+    // nonzero when the block ends with an incomplete sequence
+
+    static type incomplete( type x ) BOOST_NOEXCEPT
+    {
+        return _mm_subs_epu8( x, _mm_setr_epi8( -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+            static_cast<char>( 0xF0 - 1 ), static_cast<char>( 0xE0 - 1 ), static_cast<char>( 0xC0 - 1 ) ) );
+    }
+};
+
+#if defined(BOOST_CORE_AVX2)
+
+struct utf8_avx2
+{
+    typedef __m256i type;
+
+    static std::size_t const size = 32;
+
+    static type load( char const* p ) BOOST_NOEXCEPT
+    {
+        return _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p ) );
+    }
+
+    static type zero() BOOST_NOEXCEPT
+    {
+        return _mm256_setzero_si256();
+    }
+
+    static type or_( type x, type y ) BOOST_NOEXCEPT
+    {
+        return _mm256_or_si256( x, y );
+    }
+
+    static bool is_ascii( type x ) BOOST_NOEXCEPT
+    {
+        return _mm256_movemask_epi8( x ) == 0;
+    }
+
+    static bool is_zero( type x ) BOOST_NOEXCEPT
+    {
+        return _mm256_testz_si256( x, x ) != 0;
+    }
+
+    static type check( type x, type prev ) BOOST_NOEXCEPT
+    {
+        __m256i const m0f = _mm256_set1_epi8( 0x0F );
+
+        // the last 16 bytes of `prev` followed by the first 16 of `x`
+        __m256i const t = _mm256_permute2x128_si256( prev, x, 0x21 );
+
+        __m256i const prev1 = _mm256_alignr_epi8( x, t, 15 );
+        __m256i const prev2 = _mm256_alignr_epi8( x, t, 14 );
+        __m256i const prev3 = _mm256_alignr_epi8( x, t, 13 );
+
+        __m256i const b1h = _mm256_shuffle_epi8( _mm256_setr_epi8( BOOST_CORE_UTF8_TABLE_1HIGH, BOOST_CORE_UTF8_TABLE_1HIGH ), _mm256_and_si256( _mm256_srli_epi16( prev1, 4 ), m0f ) );
+        __m256i const b1l = _mm256_shuffle_epi8( _mm256_setr_epi8( BOOST_CORE_UTF8_TABLE_1LOW, BOOST_CORE_UTF8_TABLE_1LOW ), _mm256_and_si256( prev1, m0f ) );
+        __m256i const b2h = _mm256_shuffle_epi8( _mm256_setr_epi8( BOOST_CORE_UTF8_TABLE_2HIGH, BOOST_CORE_UTF8_TABLE_2HIGH ), _mm256_and_si256( _mm256_srli_epi16( x, 4 ), m0f ) );
+
+        __m256i const sc = _mm256_and_si256( _mm256_and_si256( b1h, b1l ), b2h );
+
+        __m256i const must23 = _mm256_or_si256( _mm256_subs_epu8( prev2, _mm256_set1_epi8( 0xE0 - 0x80 ) ), _mm256_subs_epu8( prev3, _mm256_set1_epi8( 0xF0 - 0x80 ) ) );
+
+        return _mm256_xor_si256( _mm256_and_si256( must23, _mm256_set1_epi8( static_cast<char>( 0x80 ) ) ), sc );
+    }
+
+    static type incomplete( type x ) BOOST_NOEXCEPT
+    {
+        return _mm256_subs_epu8( x, _mm256_setr_epi8(
+            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+            static_cast<char>( 0xF0 - 1 ), static_cast<char>( 0xE0 - 1 ), static_cast<char>( 0xC0 - 1 ) ) );
+    }
+};
+
+typedef utf8_avx2 utf8_simd;
+
+#else
+
+typedef utf8_sse utf8_simd;
+
+#endif
+
+#undef BOOST_CORE_UTF8_TABLE_1HIGH
+#undef BOOST_CORE_UTF8_TABLE_1LOW
+#undef BOOST_CORE_UTF8_TABLE_2HIGH
+
+// An error found in the block at `bs` involves a sequence that starts
+// at bs - 3 or later; everything before is well-formed, so the scalar
+// validation can resume at the first lead byte from there
+
+inline std::size_t utf8_locate_invalid( char const* p, std::size_t n, std::size_t bs ) BOOST_NOEXCEPT
+{
+    std::size_t i = bs >= 3? bs - 3: 0;
+
+    while( i < bs && detail::utf8_is_continuation( p[ i ] ) ) ++i;
+
+    return detail::utf8_find_invalid_scalar( p, n, i );
+}
+
+// Two blocks are processed per iteration; when both are ASCII, only the
+// absence of an incomplete sequence at the end of the previous block is
+// checked
+
+template<class S> std::size_t utf8_find_invalid_blocks( char const* p, std::size_t n ) BOOST_NOEXCEPT
+{
+    typedef typename S::type V;
+
+    std::size_t const N = S::size;
+
+    V prev = S::zero();
+    V prev_incomplete = S::zero();
+
+    std::size_t last = 0;
+
+    for( std::size_t i = 0; i < n; i += 2 * N )
+    {
+        V x0, x1;
+
+        if( n - i >= 2 * N )
+        {
+            x0 = S::load( p + i );
+            x1 = S::load( p + i + N );
+        }
+        else
+        {
+            // the last partial iteration, padded with zeroes, which are ASCII
+
+            char buffer[ 2 * N ] = {};
+            std::memcpy( buffer, p + i, n - i );
+
+            x0 = S::load( buffer );
+            x1 = S::load( buffer + N );
+        }
+
+        V err;
+
+        if( S::is_ascii( S::or_( x0, x1 ) ) )
+        {
+            err = prev_incomplete;
+            prev_incomplete = S::zero();
+        }
+        else
+        {
+            err = S::or_( S::check( x0, prev ), S::check( x1, x0 ) );
+            prev_incomplete = S::incomplete( x1 );
+        }
+
+        if( !S::is_zero( err ) ) return detail::utf8_locate_invalid( p, n, i );
+
+        prev = x1;
+        last = i;
+    }
+
+    if( !S::is_zero( prev_incomplete ) ) return detail::utf8_locate_invalid( p, n, last );
+
+    return static_cast<std::size_t>( -1 );
+}
+
+inline std::size_t utf8_find_invalid_simd( char const* p, std::size_t n ) BOOST_NOEXCEPT
+{
+    return detail::utf8_find_invalid_blocks<utf8_simd>( p, n );
+}
+
+#else
+
+// SSE2 only: skip 32 ASCII bytes at a time, validate the rest one
+// sequence at a time
+
+inline std::size_t utf8_find_invalid_simd( char const* p, std::size_t n ) BOOST_NOEXCEPT
+{
+    std::size_t i = 0;
+
+    while( i < n )
+    {
+        if( n - i >= 32 )
+        {
+            __m128i const x0 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + i ) );
+            __m128i const x1 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + i + 16 ) );
+
+            if( _mm_movemask_epi8( _mm_or_si128( x0, x1 ) ) == 0 )
+            {
+                i += 32;
+                continue;
+            }
+        }
+
+        std::size_t const m = detail::utf8_sequence_length( p, n, i );
+
+        if( m == 0 ) return i;
+
+        i += m;
+    }
+
+    return static_cast<std::size_t>( -1 );
+}
+
+#endif // #if defined(BOOST_CORE_SSSE3)
+
+// counts the bytes that are not continuation bytes; the continuation
+// bytes, 0x80-0xBF, are less than -64 as signed characters
+
+inline std::size_t utf8_count_simd( char const* p, std::size_t n ) BOOST_NOEXCEPT
+{
+    std::size_t r = 0;
+    std::size_t i = 0;
+
+#if defined(BOOST_CORE_AVX2)
+
+    for( ; i + 32 <= n; i += 32 )
+    {
+        __m256i const x = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + i ) );
+        boost::uint32_t const mask = static_cast<boost::uint32_t>( _mm256_movemask_epi8( _mm256_cmpgt_epi8( _mm256_set1_epi8( -64 ), x ) ) );
+
+        r += 32 - boost::core::popcount( mask );
+    }
+
+#endif
+
+    for( ; i + 16 <= n; i += 16 )
+    {
+        __m128i const x = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + i ) );
+        boost::uint32_t const mask = static_cast<boost::uint32_t>( _mm_movemask_epi8( _mm_cmplt_epi8( x, _mm_set1_epi8( -64 ) ) ) );
+
+        r += 16 - boost::core::popcount( mask );
+    }
+
+    return r + detail::utf8_count_scalar( p + i, n - i );
+}
+
+#endif // #if defined(BOOST_CORE_SV_SIMD)
+
+template<class Ch> BOOST_CXX14_CONSTEXPR std::size_t utf8_find_invalid( Ch const* p, std::size_t n ) BOOST_NOEXCEPT
+{
+#if defined(BOOST_CORE_SV_SIMD)
+
+    if( !detail::is_constant_evaluated() )
+    {
+        return detail::utf8_find_invalid_simd( reinterpret_cast<char const*>( p ), n );
+    }
+
+#endif
+
+    return detail::utf8_find_invalid_scalar( p, n, 0 );
+}
+
+template<class Ch> BOOST_CXX14_CONSTEXPR std::size_t utf8_count( Ch const* p, std::size_t n ) BOOST_NOEXCEPT
+{
+#if defined(BOOST_CORE_SV_SIMD)
+
+    if( !detail::is_constant_evaluated() )
+    {
+        return detail::utf8_count_simd( reinterpret_cast<char const*>( p ), n );
+    }
+
+#endif
+
+    return detail::utf8_count_scalar( p, n );
+}
+
+} // namespace detail
+
+// returns the position of the first byte of the first code unit
+// sequence in `s` that is not well-formed UTF-8, or npos
+
+BOOST_CXX14_CONSTEXPR inline std::size_t utf8_find_invalid( string_view s ) BOOST_NOEXCEPT
+{
+    return detail::utf8_find_invalid( s.data(), s.size() );
+}
+
+BOOST_CXX14_CONSTEXPR inline bool utf8_is_valid( string_view s ) BOOST_NOEXCEPT
+{
+    return detail::utf8_find_invalid( s.data(), s.size() ) == string_view::npos;
+}
+
+// returns the number of code points in `s`, which must be valid UTF-8;
+// for other input, returns the number of bytes that are not 0x80-0xBF
+
+BOOST_CXX14_CONSTEXPR inline std::size_t utf8_count( string_view s ) BOOST_NOEXCEPT
+{
+    return detail::utf8_count( s.data(), s.size() );
+}
+
+#if defined(__cpp_char8_t) && __cpp_char8_t >= 201811L
+
+BOOST_CXX14_CONSTEXPR inline std::size_t utf8_find_invalid( u8string_view s ) BOOST_NOEXCEPT
+{
+    return detail::utf8_find_invalid( s.data(), s.size() );
+}
+
+BOOST_CXX14_CONSTEXPR inline bool utf8_is_valid( u8string_view s ) BOOST_NOEXCEPT
+{
+    return detail::utf8_find_invalid( s.data(), s.size() ) == u8string_view::npos;
+}
+
+BOOST_CXX14_CONSTEXPR inline std::size_t utf8_count( u8string_view s ) BOOST_NOEXCEPT
+{
+    return detail::utf8_count( s.data(), s.size() );
+}
+
+#endif
+
+} // namespace core
+} // namespace boost
+
+#endif  // #ifndef BOOST_CORE_UTF8_HPP_INCLUDED
@@ -0,0 +1,560 @@
+#ifndef BOOST_CORE_XOSHIRO_HPP_INCLUDED
+#define BOOST_CORE_XOSHIRO_HPP_INCLUDED
+
+// MS compatible compilers support #pragma once
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+// boost::core::xoshiro256ss
+// boost::core::xoroshiro128p
+// boost::core::xoshiro256ss_x4
+//
+// The xoshiro256** and xoroshiro128+ generators of David Blackman and
+// Sebastiano Vigna, with jump() and long_jump() for independent streams,
+// seeded through splitmix64 as recommended by the authors, and
+// xoshiro256ss_x4, four interleaved xoshiro256** streams that fill
+// spans four values at a time with AVX2.
+//
+// Derived from the public domain implementations at
+// https://prng.di.unimi.it/
+//
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/core/detail/simd.hpp>
+#include <boost/core/bit.hpp>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <cstddef>
+
+#if !defined(BOOST_NO_CXX11_CONSTEXPR) && !defined(BOOST_NO_CXX11_DECLTYPE)
+# include <boost/core/span.hpp>
+# define BOOST_CORE_XOSHIRO_HAS_SPAN
+#endif
+
+namespace boost
+{
+namespace core
+{
+
+class xoshiro256ss_x4;
+
+// xoshiro256**: 256 bits of state, period 2^256 - 1
+
+class xoshiro256ss
+{
+private:
+
+    friend class xoshiro256ss_x4;
+
+    boost::uint64_t s_[ 4 ];
+
+    void jump_impl( boost::uint64_t const* poly ) BOOST_NOEXCEPT
+    {
+        boost::uint64_t t[ 4 ] = {};
+
+        for( int i = 0; i < 4; ++i )
+        {
+            for( int b = 0; b < 64; ++b )
+            {
+                if( poly[ i ] & static_cast<boost::uint64_t>( 1 ) << b )
+                {
+                    t[ 0 ] ^= s_[ 0 ];
+                    t[ 1 ] ^= s_[ 1 ];
+                    t[ 2 ] ^= s_[ 2 ];
+                    t[ 3 ] ^= s_[ 3 ];
+                }
+
+                (*this)();
+            }
+        }
+
+        s_[ 0 ] = t[ 0 ];
+        s_[ 1 ] = t[ 1 ];
+        s_[ 2 ] = t[ 2 ];
+        s_[ 3 ] = t[ 3 ];
+    }
+
+public:
+
+    typedef boost::uint64_t result_type;
+
+    static BOOST_CONSTEXPR result_type (min)() BOOST_NOEXCEPT
+    {
+        return 0;
+    }
+
+    static BOOST_CONSTEXPR result_type (max)() BOOST_NOEXCEPT
+    {
+        return ~static_cast<result_type>( 0 );
+    }
+
+    xoshiro256ss() BOOST_NOEXCEPT
+    {
+        seed( 0 );
+    }
+
+    explicit xoshiro256ss( boost::uint64_t s ) BOOST_NOEXCEPT
+    {
+        seed( s );
+    }
+
+    // the state is initialized with four outputs of splitmix64( s ),
+    // which are never all zero
+
+    void seed( boost::uint64_t s ) BOOST_NOEXCEPT
+    {
+        boost::detail::splitmix64 rng( s );
+
+        s_[ 0 ] = rng();
+        s_[ 1 ] = rng();
+        s_[ 2 ] = rng();
+        s_[ 3 ] = rng();
+    }
+
+    result_type operator()() BOOST_NOEXCEPT
+    {
+        boost::uint64_t const r = boost::core::rotl( s_[ 1 ] * 5, 7 ) * 9;
+        boost::uint64_t const t = s_[ 1 ] << 17;
+
+        s_[ 2 ] ^= s_[ 0 ];
+        s_[ 3 ] ^= s_[ 1 ];
+        s_[ 1 ] ^= s_[ 2 ];
+        s_[ 0 ] ^= s_[ 3 ];
+
+        s_[ 2 ] ^= t;
+
+        s_[ 3 ] = boost::core::rotl( s_[ 3 ], 45 );
+
+        return r;
+    }
+
+    // advances the state by 2^128 steps; 2^128 calls to jump() give
+    // non-overlapping sequences of 2^128 values each
+
+    void jump() BOOST_NOEXCEPT
+    {
+        static boost::uint64_t const poly[ 4 ] =
+        {
+            ( static_cast<boost::uint64_t>( 0x180ec6d3u ) << 32 ) + 0x3cfd0abau,
+            ( static_cast<boost::uint64_t>( 0xd5a61266u ) << 32 ) + 0xf0c9392cu,
+            ( static_cast<boost::uint64_t>( 0xa9582618u ) << 32 ) + 0xe03fc9aau,
+            ( static_cast<boost::uint64_t>( 0x39abdc45u ) << 32 ) + 0x29b1661cu,
+        };
+
+        jump_impl( poly );
+    }
+
+    // advances the state by 2^192 steps, for 2^64 starting points
+    // from each of which jump() gives 2^64 streams
+
+    void long_jump() BOOST_NOEXCEPT
+    {
+        static boost::uint64_t const poly[ 4 ] =
+        {
+            ( static_cast<boost::uint64_t>( 0x76e15d3eu ) << 32 ) + 0xfefdcbbfu,
+            ( static_cast<boost::uint64_t>( 0xc5004e44u ) << 32 ) + 0x1c522fb3u,
+            ( static_cast<boost::uint64_t>( 0x77710069u ) << 32 ) + 0x854ee241u,
+            ( static_cast<boost::uint64_t>( 0x39109bb0u ) << 32 ) + 0x2acbe635u,
+        };
+
+        jump_impl( poly );
+    }
+
+#if defined(BOOST_CORE_XOSHIRO_HAS_SPAN)
+
+    // the same values as s.size() calls to operator()
+
+    void fill( span<boost::uint64_t> s ) BOOST_NOEXCEPT
+    {
+        for( std::size_t i = 0, n = s.size(); i < n; ++i )
+        {
+            s[ i ] = (*this)();
+        }
+    }
+
+#endif
+
+    friend bool operator==( xoshiro256ss const& a, xoshiro256ss const& b ) BOOST_NOEXCEPT
+    {
+        return a.s_[ 0 ] == b.s_[ 0 ] && a.s_[ 1 ] == b.s_[ 1 ] && a.s_[ 2 ] == b.s_[ 2 ] && a.s_[ 3 ] == b.s_[ 3 ];
+    }
+
+    friend bool operator!=( xoshiro256ss const& a, xoshiro256ss const& b ) BOOST_NOEXCEPT
+    {
+        return !( a == b );
+    }
+};
+
+// xoroshiro128+: 128 bits of state, period 2^128 - 1; the fastest
+// of the family, for floating point values, since the lowest bits
+// of its output have low linear complexity
+
+class xoroshiro128p
+{
+private:
+
+    boost::uint64_t s_[ 2 ];
+
+    void jump_impl( boost::uint64_t const* poly ) BOOST_NOEXCEPT
+    {
+        boost::uint64_t t[ 2 ] = {};
+
+        for( int i = 0; i < 2; ++i )
+        {
+            for( int b = 0; b < 64; ++b )
+            {
+                if( poly[ i ] & static_cast<boost::uint64_t>( 1 ) << b )
+                {
+                    t[ 0 ] ^= s_[ 0 ];
+                    t[ 1 ] ^= s_[ 1 ];
+                }
+
+                (*this)();
+            }
+        }
+
+        s_[ 0 ] = t[ 0 ];
+        s_[ 1 ] = t[ 1 ];
+    }
+
+public:
+
+    typedef boost::uint64_t result_type;
+
+    static BOOST_CONSTEXPR result_type (min)() BOOST_NOEXCEPT
+    {
+        return 0;
+    }
+
+    static BOOST_CONSTEXPR result_type (max)() BOOST_NOEXCEPT
+    {
+        return ~static_cast<result_type>( 0 );
+    }
+
+    xoroshiro128p() BOOST_NOEXCEPT
+    {
+        seed( 0 );
+    }
+
+    explicit xoroshiro128p( boost::uint64_t s ) BOOST_NOEXCEPT
+    {
+        seed( s );
+    }
+
+    void seed( boost::uint64_t s ) BOOST_NOEXCEPT
+    {
+        boost::detail::splitmix64 rng( s );
+
+        s_[ 0 ] = rng();
+        s_[ 1 ] = rng();
+    }
+
+    result_type operator()() BOOST_NOEXCEPT
+    {
+        boost::uint64_t const s0 = s_[ 0 ];
+        boost::uint64_t s1 = s_[ 1 ];
+
+        boost::uint64_t const r = s0 + s1;
+
+        s1 ^= s0;
+
+        s_[ 0 ] = boost::core::rotl( s0, 24 ) ^ s1 ^ ( s1 << 16 );
+        s_[ 1 ] = boost::core::rotl( s1, 37 );
+
+        return r;
+    }
+
+    // advances the state by 2^64 steps
+
+    void jump() BOOST_NOEXCEPT
+    {
+        static boost::uint64_t const poly[ 2 ] =
+        {
+            ( static_cast<boost::uint64_t>( 0xdf900294u ) << 32 ) + 0xd8f554a5u,
+            ( static_cast<boost::uint64_t>( 0x170865dfu ) << 32 ) + 0x4b3201fcu,
+        };
+
+        jump_impl( poly );
+    }
+
+    // advances the state by 2^96 steps
+
+    void long_jump() BOOST_NOEXCEPT
+    {
+        static boost::uint64_t const poly[ 2 ] =
+        {
+            ( static_cast<boost::uint64_t>( 0xd2a98b26u ) << 32 ) + 0x625eee7bu,
+            ( static_cast<boost::uint64_t>( 0xdddf9b10u ) << 32 ) + 0x90aa7ac1u,
+        };
+
+        jump_impl( poly );
+    }
+
+#if defined(BOOST_CORE_XOSHIRO_HAS_SPAN)
+
+    void fill( span<boost::uint64_t> s ) BOOST_NOEXCEPT
+    {
+        for( std::size_t i = 0, n = s.size(); i < n; ++i )
+        {
+            s[ i ] = (*this)();
+        }
+    }
+
+#endif
+
+    friend bool operator==( xoroshiro128p const& a, xoroshiro128p const& b ) BOOST_NOEXCEPT
+    {
+        return a.s_[ 0 ] == b.s_[ 0 ] && a.s_[ 1 ] == b.s_[ 1 ];
+    }
+
+    friend bool operator!=( xoroshiro128p const& a, xoroshiro128p const& b ) BOOST_NOEXCEPT
+    {
+        return !( a == b );
+    }
+};
+
+// xoshiro256ss_x4: four xoshiro256** streams, 2^128 steps apart (lane k
+// starts at the state of lane 0 after k jumps), whose outputs are
+// interleaved: the values are lane 0, 1, 2, 3, 0, 1, ... The sequence
+// does not depend on whether the SIMD code path is used.
+
+class xoshiro256ss_x4
+{
+private:
+
+    // s_[ i ][ k ] is word i of the state of lane k
+
+    boost::uint64_t s_[ 4 ][ 4 ];
+
+    // the last four values, of which r_[ i_ ] .. r_[ 3 ] are not
+    // yet returned
+
+    boost::uint64_t r_[ 4 ];
+    int i_;
+
+    void init( xoshiro256ss g ) BOOST_NOEXCEPT
+    {
+        for( int k = 0; k < 4; ++k )
+        {
+            set_lane( k, g );
+            g.jump();
+        }
+
+        i_ = 4;
+    }
+
+    xoshiro256ss get_lane( int k ) const BOOST_NOEXCEPT
+    {
+        xoshiro256ss g;
+
+        for( int i = 0; i < 4; ++i )
+        {
+            g.s_[ i ] = s_[ i ][ k ];
+        }
+
+        return g;
+    }
+
+    void set_lane( int k, xoshiro256ss const& g ) BOOST_NOEXCEPT
+    {
+        for( int i = 0; i < 4; ++i )
+        {
+            s_[ i ][ k ] = g.s_[ i ];
+        }
+    }
+
+    void next( boost::uint64_t* r ) BOOST_NOEXCEPT
+    {
+        for( int k = 0; k < 4; ++k )
+        {
+            r[ k ] = boost::core::rotl( s_[ 1 ][ k ] * 5, 7 ) * 9;
+
+            boost::uint64_t const t = s_[ 1 ][ k ] << 17;
+
+            s_[ 2 ][ k ] ^= s_[ 0 ][ k ];
+            s_[ 3 ][ k ] ^= s_[ 1 ][ k ];
+            s_[ 1 ][ k ] ^= s_[ 2 ][ k ];
+            s_[ 0 ][ k ] ^= s_[ 3 ][ k ];
+
+            s_[ 2 ][ k ] ^= t;
+
+            s_[ 3 ][ k ] = boost::core::rotl( s_[ 3 ][ k ], 45 );
+        }
+    }
+
+#if defined(BOOST_CORE_AVX2)
+
+    static __m256i rotl( __m256i x, int k ) BOOST_NOEXCEPT
+    {
+        return _mm256_or_si256( _mm256_slli_epi64( x, k ), _mm256_srli_epi64( x, 64 - k ) );
+    }
+
+    // stores n values, n a multiple of 4; x * 5 and x * 9 are computed
+    // as shifts and adds, since AVX2 has no 64 bit multiplication
+
+    void next_avx2( boost::uint64_t* r, std::size_t n ) BOOST_NOEXCEPT
+    {
+        __m256i s0 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( s_[ 0 ] ) );
+        __m256i s1 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( s_[ 1 ] ) );
+        __m256i s2 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( s_[ 2 ] ) );
+        __m256i s3 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( s_[ 3 ] ) );
+
+        for( std::size_t i = 0; i < n; i += 4 )
+        {
+            __m256i x = _mm256_add_epi64( s1, _mm256_slli_epi64( s1, 2 ) );
+            x = rotl( x, 7 );
+            x = _mm256_add_epi64( x, _mm256_slli_epi64( x, 3 ) );
+
+            _mm256_storeu_si256( reinterpret_cast<__m256i*>( r + i ), x );
+
+            __m256i const t = _mm256_slli_epi64( s1, 17 );
+
+            s2 = _mm256_xor_si256( s2, s0 );
+            s3 = _mm256_xor_si256( s3, s1 );
+            s1 = _mm256_xor_si256( s1, s2 );
+            s0 = _mm256_xor_si256( s0, s3 );
+
+            s2 = _mm256_xor_si256( s2, t );
+
+            s3 = rotl( s3, 45 );
+        }
+
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( s_[ 0 ] ), s0 );
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( s_[ 1 ] ), s1 );
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( s_[ 2 ] ), s2 );
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( s_[ 3 ] ), s3 );
+    }
+
+#endif
+
+public:
+
+    typedef boost::uint64_t result_type;
+
+    static BOOST_CONSTEXPR result_type (min)() BOOST_NOEXCEPT
+    {
+        return 0;
+    }
+
+    static BOOST_CONSTEXPR result_type (max)() BOOST_NOEXCEPT
+    {
+        return ~static_cast<result_type>( 0 );
+    }
+
+    xoshiro256ss_x4() BOOST_NOEXCEPT
+    {
+        init( xoshiro256ss() );
+    }
+
+    explicit xoshiro256ss_x4( boost::uint64_t s ) BOOST_NOEXCEPT
+    {
+        init( xoshiro256ss( s ) );
+    }
+
+    // lane 0 starts at the state of g
+
+    explicit xoshiro256ss_x4( xoshiro256ss const& g ) BOOST_NOEXCEPT
+    {
+        init( g );
+    }
+
+    void seed( boost::uint64_t s ) BOOST_NOEXCEPT
+    {
+        init( xoshiro256ss( s ) );
+    }
+
+    result_type operator()() BOOST_NOEXCEPT
+    {
+        if( i_ == 4 )
+        {
+            next( r_ );
+            i_ = 0;
+        }
+
+        return r_[ i_++ ];
+    }
+
+    // advances each lane by 4 * 2^128 steps, to the streams that
+    // follow those of the four lanes; discards the unreturned values
+    // of the last step
+
+    void jump() BOOST_NOEXCEPT
+    {
+        for( int k = 0; k < 4; ++k )
+        {
+            xoshiro256ss g = get_lane( k );
+
+            g.jump();
+            g.jump();
+            g.jump();
+            g.jump();
+
+            set_lane( k, g );
+        }
+
+        i_ = 4;
+    }
+
+    // advances each lane by 2^192 steps
+
+    void long_jump() BOOST_NOEXCEPT
+    {
+        for( int k = 0; k < 4; ++k )
+        {
+            xoshiro256ss g = get_lane( k );
+            g.long_jump();
+            set_lane( k, g );
+        }
+
+        i_ = 4;
+    }
+
+#if defined(BOOST_CORE_XOSHIRO_HAS_SPAN)
+
+    // the same values as s.size() calls to operator()
+
+    void fill( span<boost::uint64_t> s ) BOOST_NOEXCEPT
+    {
+        boost::uint64_t* p = s.data();
+        std::size_t n = s.size();
+
+        for( ; n > 0 && i_ < 4; --n )
+        {
+            *p++ = r_[ i_++ ];
+        }
+
+        std::size_t const m = n & ~static_cast<std::size_t>( 3 );
+
+#if defined(BOOST_CORE_AVX2)
+
+        next_avx2( p, m );
+
+#else
+
+        for( std::size_t i = 0; i < m; i += 4 )
+        {
+            next( p + i );
+        }
+
+#endif
+
+        for( std::size_t i = m; i < n; ++i )
+        {
+            p[ i ] = (*this)();
+        }
+    }
+
+#endif
+};
+
+} // namespace core
+} // namespace boost
+
+#undef BOOST_CORE_XOSHIRO_HAS_SPAN
+
+#endif  // #ifndef BOOST_CORE_XOSHIRO_HPP_INCLUDED
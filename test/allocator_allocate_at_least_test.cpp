@@ -0,0 +1,88 @@
+/*
+Copyright 2026
+
+Distributed under the Boost Software License, Version 1.0.
+(http://www.boost.org/LICENSE_1_0.txt)
+*/
+#include <boost/core/allocator_access.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+template<class T>
+struct A1 {
+    typedef T value_type;
+    typedef T* pointer;
+    typedef std::size_t size_type;
+    A1() { }
+    T* allocate(std::size_t) {
+        return 0;
+    }
+    boost::allocation_result<T*> allocate_at_least(std::size_t n) {
+        boost::allocation_result<T*> r = { &value, n + 2 };
+        return r;
+    }
+    T value;
+};
+
+template<class T>
+struct A2 {
+    typedef T value_type;
+    typedef T* pointer;
+    typedef std::size_t size_type;
+    A2() { }
+    T* allocate(std::size_t) {
+        return &value;
+    }
+    T value;
+};
+
+#if !defined(BOOST_NO_CXX11_ALLOCATOR)
+template<class P>
+struct R {
+    P ptr;
+    unsigned count;
+};
+
+template<class T>
+struct A3 {
+    typedef T value_type;
+    typedef T* pointer;
+    typedef unsigned size_type;
+    A3() { }
+    T* allocate(unsigned) {
+        return 0;
+    }
+    R<T*> allocate_at_least(unsigned n) {
+        R<T*> r = { &value, n * 2 };
+        return r;
+    }
+    T value;
+};
+#endif
+
+int main()
+{
+    {
+        A1<int> a;
+        boost::allocation_result<int*> r =
+            boost::allocator_allocate_at_least(a, 3);
+        BOOST_TEST(r.ptr == &a.value);
+        BOOST_TEST_EQ(r.count, 5);
+    }
+    {
+        A2<int> a;
+        boost::allocation_result<int*> r =
+            boost::allocator_allocate_at_least(a, 3);
+        BOOST_TEST(r.ptr == &a.value);
+        BOOST_TEST_EQ(r.count, 3);
+    }
+#if !defined(BOOST_NO_CXX11_ALLOCATOR)
+    {
+        A3<int> a;
+        boost::allocation_result<int*, unsigned> r =
+            boost::allocator_allocate_at_least(a, 3);
+        BOOST_TEST(r.ptr == &a.value);
+        BOOST_TEST_EQ(r.count, 6);
+    }
+#endif
+    return boost::report_errors();
+}
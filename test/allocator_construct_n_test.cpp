@@ -14,6 +14,27 @@ struct A {
     A() { }
 };
 
+#if !defined(BOOST_NO_CXX11_ALLOCATOR)
+template<class T>
+struct B {
+    typedef T value_type;
+    B() { }
+    template<class U, class... V>
+    void construct(U* p, V&&...) {
+        ::new((void*)p) U(7);
+    }
+};
+#endif
+
+struct P {
+    int x;
+    double y;
+};
+
+struct M {
+    int P::* m;
+};
+
 int main()
 {
     {
@@ -43,5 +64,87 @@ int main()
         BOOST_TEST_EQ(i[1], 2);
         BOOST_TEST_EQ(i[2], 3);
     }
+    {
+        A<int> a;
+        int i[11];
+        int j[3] = { 1, 2, 3 };
+        for (std::size_t n = 0; n < 11; ++n) {
+            for (std::size_t m = 1; m < 4; ++m) {
+                for (std::size_t k = 0; k < 11; ++k) {
+                    i[k] = -1;
+                }
+                boost::allocator_construct_n(a, &i[0], n, &j[0], m);
+                for (std::size_t k = 0; k < n; ++k) {
+                    BOOST_TEST_EQ(i[k], j[k % m]);
+                }
+                for (std::size_t k = n; k < 11; ++k) {
+                    BOOST_TEST_EQ(i[k], -1);
+                }
+            }
+        }
+    }
+    {
+        A<int> a;
+        int i[3] = { 5, 5, 5 };
+        const int j[2] = { 1, 2 };
+        boost::allocator_construct_n(a, &i[0], 2, &j[0]);
+        BOOST_TEST_EQ(i[0], 1);
+        BOOST_TEST_EQ(i[1], 2);
+        BOOST_TEST_EQ(i[2], 5);
+        boost::allocator_construct_n(a, &i[0], 0, &j[0]);
+        BOOST_TEST_EQ(i[0], 1);
+    }
+    {
+        A<double> a;
+        double d[3] = { 5, 5, 5 };
+        const int j[3] = { 1, 2, 3 };
+        boost::allocator_construct_n(a, &d[0], 3, &j[0]);
+        BOOST_TEST_EQ(d[0], 1);
+        BOOST_TEST_EQ(d[1], 2);
+        BOOST_TEST_EQ(d[2], 3);
+    }
+    {
+        A<P> a;
+        P p[2] = { { 5, 5 }, { 5, 5 } };
+        boost::allocator_construct_n(a, &p[0], 2);
+        BOOST_TEST_EQ(p[0].x, 0);
+        BOOST_TEST_EQ(p[1].y, 0);
+        P q[2] = { { 1, 2 }, { 3, 4 } };
+        boost::allocator_construct_n(a, &p[0], 2, &q[0]);
+        BOOST_TEST_EQ(p[0].x, 1);
+        BOOST_TEST_EQ(p[1].y, 4);
+    }
+    {
+        A<int P::*> a;
+        int P::* m[2] = { &P::x, &P::x };
+        boost::allocator_construct_n(a, &m[0], 2);
+        BOOST_TEST(m[0] == 0);
+        BOOST_TEST(m[1] == 0);
+    }
+    {
+        A<M> a;
+        M m[2] = { { &P::x }, { &P::x } };
+        boost::allocator_construct_n(a, &m[0], 2);
+        BOOST_TEST(m[0].m == 0);
+        BOOST_TEST(m[1].m == 0);
+    }
+#if !defined(BOOST_NO_CXX11_ALLOCATOR)
+    {
+        B<int> a;
+        int i[3] = { 5, 5, 5 };
+        int j[3] = { 1, 2, 3 };
+        boost::allocator_construct_n(a, &i[0], 3);
+        BOOST_TEST_EQ(i[0], 7);
+        BOOST_TEST_EQ(i[2], 7);
+        i[0] = i[1] = i[2] = 5;
+        boost::allocator_construct_n(a, &i[0], 3, &j[0], 2);
+        BOOST_TEST_EQ(i[0], 7);
+        BOOST_TEST_EQ(i[2], 7);
+        i[0] = i[1] = i[2] = 5;
+        boost::allocator_construct_n(a, &i[0], 3, &j[0]);
+        BOOST_TEST_EQ(i[0], 7);
+        BOOST_TEST_EQ(i[2], 7);
+    }
+#endif
     return boost::report_errors();
 }
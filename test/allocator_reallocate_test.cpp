@@ -0,0 +1,249 @@
+/*
+Copyright 2026
+
+Distributed under the Boost Software License, Version 1.0.
+(http://www.boost.org/LICENSE_1_0.txt)
+*/
+#include <boost/core/allocator_access.hpp>
+#include <boost/core/default_allocator.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+
+template<class T>
+struct A1 {
+    typedef T value_type;
+    typedef T* pointer;
+    typedef std::size_t size_type;
+    A1()
+        : expanded(0) { }
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(::operator new(sizeof(T) * n));
+    }
+    void deallocate(T* p, std::size_t) {
+        ::operator delete(p);
+    }
+    bool expand(T*, std::size_t, std::size_t m) {
+        ++expanded;
+        return m <= 8;
+    }
+    int expanded;
+};
+
+template<class T>
+struct A2 {
+    typedef T value_type;
+    typedef T* pointer;
+    typedef std::size_t size_type;
+    A2()
+        : reallocated(0) { }
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(::operator new(sizeof(T) * n));
+    }
+    void deallocate(T* p, std::size_t) {
+        ::operator delete(p);
+    }
+    T* reallocate(T* p, std::size_t n, std::size_t m) {
+        ++reallocated;
+        T* q = allocate(m);
+        std::memcpy(static_cast<void*>(q), p, sizeof(T) * (n < m ? n : m));
+        deallocate(p, n);
+        return q;
+    }
+    int reallocated;
+};
+
+template<class T>
+struct A3 {
+    typedef T value_type;
+    A3() { }
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(::operator new(sizeof(T) * n));
+    }
+    void deallocate(T* p, std::size_t) {
+        ::operator delete(p);
+    }
+};
+
+struct H {
+    static int live;
+
+    explicit H(int v)
+        : p(new int(v)) {
+        ++live;
+    }
+
+    H(const H& other)
+        : p(new int(*other.p)) {
+        ++live;
+    }
+
+    ~H() {
+        delete p;
+        --live;
+    }
+
+    int* p;
+
+private:
+    H& operator=(const H&);
+};
+
+int H::live = 0;
+
+namespace boost {
+
+template<>
+struct is_trivially_relocatable<H> {
+    BOOST_STATIC_CONSTEXPR bool value = true;
+};
+
+} /* boost */
+
+struct E {
+    static int live;
+    static int copies;
+
+    explicit E(int v)
+        : v(v) {
+        ++live;
+    }
+
+    E(const E& other)
+        : v(other.v) {
+        if (++copies == 3) {
+            throw 1;
+        }
+        ++live;
+    }
+
+    ~E() {
+        --live;
+    }
+
+    int v;
+
+private:
+    E& operator=(const E&);
+};
+
+int E::live = 0;
+int E::copies = 0;
+
+template<class A>
+typename A::value_type*
+make(A& a, std::size_t n)
+{
+    typename A::value_type* p = a.allocate(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        boost::allocator_construct(a, p + i, static_cast<int>(i));
+    }
+    return p;
+}
+
+void test_expand()
+{
+    A1<int> a;
+    int* p = make(a, 4);
+    BOOST_TEST(boost::allocator_expand(a, p, 4, 8));
+    BOOST_TEST(boost::allocator_reallocate(a, p, 4, 8, 4) == p);
+    BOOST_TEST(boost::allocator_reallocate(a, p, 8, 8, 4) == p);
+    BOOST_TEST_EQ(a.expanded, 2);
+    int* q = boost::allocator_reallocate(a, p, 8, 16, 4);
+    BOOST_TEST(q != p);
+    BOOST_TEST_EQ(a.expanded, 3);
+    BOOST_TEST_EQ(q[3], 3);
+    a.deallocate(q, 16);
+    A3<int> b;
+    p = b.allocate(4);
+    BOOST_TEST(!boost::allocator_expand(b, p, 4, 5));
+    b.deallocate(p, 4);
+}
+
+void test_reallocate()
+{
+    A2<int> a;
+    int* p = make(a, 4);
+    p = boost::allocator_reallocate(a, p, 4, 100, 4);
+    BOOST_TEST_EQ(a.reallocated,
+        boost::is_trivially_relocatable<int>::value ? 1 : 0);
+    BOOST_TEST_EQ(p[0], 0);
+    BOOST_TEST_EQ(p[3], 3);
+    p = boost::allocator_reallocate(a, p, 100, 2, 2);
+    BOOST_TEST_EQ(p[1], 1);
+    a.deallocate(p, 2);
+    A2<H> b;
+    H* q = make(b, 3);
+    q = boost::allocator_reallocate(b, q, 3, 6, 3);
+    BOOST_TEST_EQ(b.reallocated, 1);
+    BOOST_TEST_EQ(H::live, 3);
+    BOOST_TEST_EQ(*q[2].p, 2);
+    boost::allocator_destroy_n(b, q, 3);
+    b.deallocate(q, 6);
+    BOOST_TEST_EQ(H::live, 0);
+}
+
+void test_relocate()
+{
+    std::allocator<std::string> a;
+    std::string* p = a.allocate(3);
+    for (int i = 0; i < 3; ++i) {
+        boost::allocator_construct(a, p + i, std::string(40, 'a' + i));
+    }
+    p = boost::allocator_reallocate(a, p, 3, 10, 3);
+    BOOST_TEST_EQ(p[0], std::string(40, 'a'));
+    BOOST_TEST_EQ(p[2], std::string(40, 'c'));
+    boost::allocator_destroy_n(a, p, 3);
+    a.deallocate(p, 10);
+    A3<H> b;
+    H* q = make(b, 4);
+    q = boost::allocator_reallocate(b, q, 4, 5, 4);
+    BOOST_TEST_EQ(H::live, 4);
+    BOOST_TEST_EQ(*q[3].p, 3);
+    boost::allocator_destroy_n(b, q, 4);
+    b.deallocate(q, 5);
+    BOOST_TEST_EQ(H::live, 0);
+}
+
+void test_throw()
+{
+    A3<E> a;
+    E* p = make(a, 4);
+    BOOST_TEST_THROWS(boost::allocator_reallocate(a, p, 4, 8, 4), int);
+    BOOST_TEST_EQ(E::live, 4);
+    BOOST_TEST_EQ(p[3].v, 3);
+    boost::allocator_destroy_n(a, p, 4);
+    a.deallocate(p, 4);
+    BOOST_TEST_EQ(E::live, 0);
+}
+
+void test_default()
+{
+    boost::default_allocator<int> a;
+    int* p = make(a, 10);
+    for (std::size_t n = 10; n < 1000000; n *= 4) {
+        p = boost::allocator_reallocate(a, p, n, n * 4, n);
+        BOOST_TEST_EQ(p[9], 9);
+        for (std::size_t i = n; i < n * 4; ++i) {
+            p[i] = static_cast<int>(i);
+        }
+    }
+    BOOST_TEST_EQ(p[655359], 655359);
+    a.deallocate(p, 2560000);
+    boost::default_allocator<std::string> b;
+    std::string* q = b.allocate(2);
+    boost::allocator_construct(b, q, "abc");
+    q = boost::allocator_reallocate(b, q, 2, 4, 1);
+    BOOST_TEST_EQ(q[0], "abc");
+    boost::allocator_destroy(b, q);
+    b.deallocate(q, 4);
+}
+
+int main()
+{
+    test_expand();
+    test_reallocate();
+    test_relocate();
+    test_throw();
+    test_default();
+    return boost::report_errors();
+}
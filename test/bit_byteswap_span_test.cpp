@@ -0,0 +1,112 @@
+// Test for boost/core/bit.hpp (byteswap_inplace and the span overloads
+// of load_le, load_be, store_le and store_be)
+//
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/config.hpp>
+#include <boost/config/pragma_message.hpp>
+
+#if defined(BOOST_NO_CXX11_CONSTEXPR) || defined(BOOST_NO_CXX11_DECLTYPE)
+
+BOOST_PRAGMA_MESSAGE( "Test skipped because boost/core/span.hpp is not supported" )
+int main() {}
+
+#else
+
+#include <boost/core/bit.hpp>
+#include <boost/core/span.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/cstdint.hpp>
+#include <vector>
+#include <cstddef>
+
+template<class T> void test( boost::detail::splitmix64& rng )
+{
+    // sizes around the 16 and 32 byte blocks, at every alignment
+    // of the first element
+
+    for( std::size_t n = 0; n < 80; ++n )
+    {
+        for( std::size_t first = 0; first < 4; ++first )
+        {
+            std::vector<T> v( first + n );
+
+            for( std::size_t i = 0; i < v.size(); ++i )
+            {
+                v[ i ] = static_cast<T>( rng() );
+            }
+
+            std::vector<T> const v0( v );
+
+            boost::span<T> s( v.data() + first, n );
+
+            boost::core::byteswap_inplace( s );
+
+            for( std::size_t i = 0; i < v.size(); ++i )
+            {
+                BOOST_TEST_EQ( v[ i ], i < first? v0[ i ]: boost::core::byteswap( v0[ i ] ) );
+            }
+
+            // the byte buffer is offset by one so that it is misaligned
+
+            std::vector<unsigned char> b( n * sizeof(T) + 1 );
+
+            boost::core::store_le( b.data() + 1, boost::span<T const>( v0.data() + first, n ) );
+
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                BOOST_TEST_EQ( boost::core::load_le<T>( b.data() + 1 + i * sizeof(T) ), v0[ first + i ] );
+            }
+
+            boost::core::load_le( s, b.data() + 1 );
+
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                BOOST_TEST_EQ( s[ i ], v0[ first + i ] );
+            }
+
+            boost::core::store_be( b.data() + 1, s );
+
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                BOOST_TEST_EQ( boost::core::load_be<T>( b.data() + 1 + i * sizeof(T) ), v0[ first + i ] );
+            }
+
+            boost::core::byteswap_inplace( s );
+            boost::core::load_be( s, b.data() + 1 );
+
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                BOOST_TEST_EQ( s[ i ], v0[ first + i ] );
+            }
+        }
+    }
+}
+
+int main()
+{
+    {
+        boost::uint32_t a[] = { 0x01020304, 0x05060708 };
+
+        boost::core::byteswap_inplace( boost::span<boost::uint32_t, 2>( a ) );
+
+        BOOST_TEST_EQ( a[ 0 ], 0x04030201u );
+        BOOST_TEST_EQ( a[ 1 ], 0x08070605u );
+    }
+
+    boost::detail::splitmix64 rng;
+
+    test<boost::uint8_t>( rng );
+    test<boost::uint16_t>( rng );
+    test<boost::uint32_t>( rng );
+    test<boost::uint64_t>( rng );
+    test<boost::int16_t>( rng );
+    test<boost::int64_t>( rng );
+
+    return boost::report_errors();
+}
+
+#endif
@@ -0,0 +1,116 @@
+// Test for boost/core/bit.hpp (byteswap, load_le, load_be, store_le, store_be)
+//
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/bit.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/cstdint.hpp>
+#include <cstring>
+#include <cstddef>
+
+template<class T> T ref_byteswap( T x )
+{
+    unsigned char b[ sizeof(T) ];
+    std::memcpy( b, &x, sizeof(T) );
+
+    for( std::size_t i = 0; i < sizeof(T) / 2; ++i )
+    {
+        unsigned char t = b[ i ];
+        b[ i ] = b[ sizeof(T) - 1 - i ];
+        b[ sizeof(T) - 1 - i ] = t;
+    }
+
+    std::memcpy( &x, b, sizeof(T) );
+    return x;
+}
+
+template<class T> void test( boost::detail::splitmix64& rng )
+{
+    for( int i = 0; i < 1000; ++i )
+    {
+        T const x = static_cast<T>( rng() );
+
+        BOOST_TEST_EQ( boost::core::byteswap( x ), ref_byteswap( x ) );
+        BOOST_TEST_EQ( boost::core::byteswap( boost::core::byteswap( x ) ), x );
+
+        // the buffer is larger than T so that the accesses are unaligned
+
+        unsigned char b[ sizeof(T) + 1 ] = {};
+
+        boost::core::store_le( b + 1, x );
+
+        for( std::size_t j = 0; j < sizeof(T); ++j )
+        {
+            BOOST_TEST_EQ( b[ j + 1 ], static_cast<unsigned char>( static_cast<boost::uint64_t>( x ) >> ( j * 8 ) ) );
+        }
+
+        BOOST_TEST_EQ( boost::core::load_le<T>( b + 1 ), x );
+        BOOST_TEST_EQ( boost::core::load_be<T>( b + 1 ), boost::core::byteswap( x ) );
+
+        boost::core::store_be( b + 1, x );
+
+        for( std::size_t j = 0; j < sizeof(T); ++j )
+        {
+            BOOST_TEST_EQ( b[ sizeof(T) - j ], static_cast<unsigned char>( static_cast<boost::uint64_t>( x ) >> ( j * 8 ) ) );
+        }
+
+        BOOST_TEST_EQ( boost::core::load_be<T>( b + 1 ), x );
+    }
+}
+
+static boost::uint64_t u64( boost::uint32_t hi, boost::uint32_t lo )
+{
+    return static_cast<boost::uint64_t>( hi ) << 32 | lo;
+}
+
+int main()
+{
+    BOOST_TEST_EQ( boost::core::byteswap( static_cast<boost::uint8_t>( 0x12 ) ), 0x12 );
+    BOOST_TEST_EQ( boost::core::byteswap( static_cast<boost::uint16_t>( 0x1234 ) ), 0x3412 );
+    BOOST_TEST_EQ( boost::core::byteswap( static_cast<boost::uint32_t>( 0x12345678 ) ), 0x78563412 );
+    BOOST_TEST_EQ( boost::core::byteswap( u64( 0x01234567, 0x89ABCDEF ) ), u64( 0xEFCDAB89, 0x67452301 ) );
+    BOOST_TEST_EQ( boost::core::byteswap( static_cast<boost::int16_t>( 0x0080 ) ), static_cast<boost::int16_t>( -32768 ) );
+    BOOST_TEST_EQ( boost::core::byteswap( static_cast<boost::int32_t>( -2 ) ), static_cast<boost::int32_t>( 0xFEFFFFFF ) );
+
+    {
+        unsigned char const b[] = { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08 };
+
+        BOOST_TEST_EQ( boost::core::load_le<boost::uint16_t>( b ), 0x0201 );
+        BOOST_TEST_EQ( boost::core::load_be<boost::uint16_t>( b ), 0x0102 );
+        BOOST_TEST_EQ( boost::core::load_le<boost::uint32_t>( b ), 0x04030201u );
+        BOOST_TEST_EQ( boost::core::load_be<boost::uint32_t>( b ), 0x01020304u );
+        BOOST_TEST_EQ( boost::core::load_le<boost::uint64_t>( b ), u64( 0x08070605, 0x04030201 ) );
+        BOOST_TEST_EQ( boost::core::load_be<boost::uint64_t>( b ), u64( 0x01020304, 0x05060708 ) );
+        BOOST_TEST_EQ( boost::core::load_be<boost::int16_t>( b + 6 ), 0x0708 );
+    }
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+
+    {
+        constexpr boost::uint16_t r1 = boost::core::byteswap( static_cast<boost::uint16_t>( 0x1234 ) );
+        constexpr boost::uint32_t r2 = boost::core::byteswap( static_cast<boost::uint32_t>( 0x12345678 ) );
+        constexpr boost::uint64_t r3 = boost::core::byteswap( static_cast<boost::uint64_t>( 0x0123456789ABCDEFull ) );
+
+        BOOST_TEST_EQ( r1, 0x3412 );
+        BOOST_TEST_EQ( r2, 0x78563412u );
+        BOOST_TEST_EQ( r3, u64( 0xEFCDAB89, 0x67452301 ) );
+    }
+
+#endif
+
+    boost::detail::splitmix64 rng;
+
+    test<unsigned char>( rng );
+    test<unsigned short>( rng );
+    test<unsigned int>( rng );
+    test<unsigned long>( rng );
+    test<boost::uint64_t>( rng );
+    test<short>( rng );
+    test<int>( rng );
+    test<boost::int64_t>( rng );
+
+    return boost::report_errors();
+}
@@ -48,6 +48,20 @@ int main()
         test_bit_ceil( boost::uint64_t( 1 ) << 63 );
     }
 
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+
+    {
+        constexpr unsigned char r1 = boost::core::bit_ceil( static_cast<unsigned char>( 5 ) );
+        constexpr unsigned r2 = boost::core::bit_ceil( 0x40000001u );
+        constexpr boost::uint64_t r3 = boost::core::bit_ceil( static_cast<boost::uint64_t>( 1 ) );
+
+        BOOST_TEST_EQ( r1, 8 );
+        BOOST_TEST_EQ( r2, 0x80000000u );
+        BOOST_TEST_EQ( r3, 1u );
+    }
+
+#endif
+
     boost::detail::splitmix64 rng;
 
     for( int i = 0; i < 1000; ++i )
@@ -0,0 +1,145 @@
+// Test for boost/core/bit.hpp (bit_deposit, bit_extract, select)
+//
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/bit.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/cstdint.hpp>
+#include <limits>
+
+template<class T> T ref_deposit( T x, T mask )
+{
+    T r = 0;
+    int j = 0;
+
+    for( int i = 0; i < std::numeric_limits<T>::digits; ++i )
+    {
+        if( ( mask >> i ) & 1 )
+        {
+            if( ( x >> j ) & 1 ) r = static_cast<T>( r | static_cast<T>( 1 ) << i );
+            ++j;
+        }
+    }
+
+    return r;
+}
+
+template<class T> T ref_extract( T x, T mask )
+{
+    T r = 0;
+    int j = 0;
+
+    for( int i = 0; i < std::numeric_limits<T>::digits; ++i )
+    {
+        if( ( mask >> i ) & 1 )
+        {
+            if( ( x >> i ) & 1 ) r = static_cast<T>( r | static_cast<T>( 1 ) << j );
+            ++j;
+        }
+    }
+
+    return r;
+}
+
+template<class T> int ref_select( T x, int k )
+{
+    for( int i = 0; i < std::numeric_limits<T>::digits; ++i )
+    {
+        if( ( x >> i ) & 1 )
+        {
+            if( k == 0 ) return i;
+            --k;
+        }
+    }
+
+    return std::numeric_limits<T>::digits;
+}
+
+template<class T> void test( boost::detail::splitmix64& rng )
+{
+    int const N = std::numeric_limits<T>::digits;
+
+    for( int i = 0; i < 2000; ++i )
+    {
+        T const x = static_cast<T>( rng() );
+        T mask = static_cast<T>( rng() );
+
+        // sparse and dense masks as well
+
+        if( i % 3 == 1 ) mask = static_cast<T>( mask & rng() & rng() );
+        if( i % 3 == 2 ) mask = static_cast<T>( mask | rng() | rng() );
+
+        BOOST_TEST_EQ( boost::core::bit_deposit( x, mask ), ref_deposit( x, mask ) );
+        BOOST_TEST_EQ( boost::core::bit_extract( x, mask ), ref_extract( x, mask ) );
+        BOOST_TEST_EQ( boost::core::bit_extract( boost::core::bit_deposit( x, mask ), mask ), ref_extract( ref_deposit( x, mask ), mask ) );
+
+        int const k = static_cast<int>( rng() % N );
+
+        BOOST_TEST_EQ( boost::core::select( mask, k ), ref_select( mask, k ) );
+    }
+
+    T const all = static_cast<T>( ~static_cast<T>( 0 ) );
+
+    BOOST_TEST_EQ( boost::core::bit_deposit( all, static_cast<T>( 0 ) ), 0 );
+    BOOST_TEST_EQ( boost::core::bit_extract( all, static_cast<T>( 0 ) ), 0 );
+    BOOST_TEST_EQ( boost::core::bit_deposit( static_cast<T>( 0x5A ), all ), 0x5A );
+    BOOST_TEST_EQ( boost::core::bit_extract( static_cast<T>( 0x5A ), all ), 0x5A );
+
+    for( int k = 0; k < N; ++k )
+    {
+        BOOST_TEST_EQ( boost::core::select( all, k ), k );
+        BOOST_TEST_EQ( boost::core::select( static_cast<T>( 0 ), k ), N );
+        BOOST_TEST_EQ( boost::core::select( static_cast<T>( static_cast<T>( 1 ) << k ), 0 ), k );
+        BOOST_TEST_EQ( boost::core::select( static_cast<T>( static_cast<T>( 1 ) << k ), 1 ), N );
+    }
+
+    BOOST_TEST_EQ( boost::core::select( all, N ), N );
+    BOOST_TEST_EQ( boost::core::select( all, N + 1 ), N );
+    BOOST_TEST_EQ( boost::core::select( all, 1000 ), N );
+    BOOST_TEST_EQ( boost::core::select( all, -1 ), N );
+    BOOST_TEST_EQ( boost::core::select( static_cast<T>( 0x10 ), N ), N );
+}
+
+int main()
+{
+    // Morton code of two 16 bit coordinates
+
+    {
+        boost::uint32_t const mx = 0x55555555, my = 0xAAAAAAAA;
+        boost::uint32_t const z = boost::core::bit_deposit<boost::uint32_t>( 0x1234, mx ) | boost::core::bit_deposit<boost::uint32_t>( 0xABCD, my );
+
+        BOOST_TEST_EQ( boost::core::bit_extract( z, mx ), 0x1234u );
+        BOOST_TEST_EQ( boost::core::bit_extract( z, my ), 0xABCDu );
+    }
+
+    BOOST_TEST_EQ( boost::core::select( 0x0F0u, 0 ), 4 );
+    BOOST_TEST_EQ( boost::core::select( 0x0F0u, 3 ), 7 );
+    BOOST_TEST_EQ( boost::core::select( 0x0F0u, 4 ), 32 );
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+
+    {
+        constexpr unsigned r1 = boost::core::bit_deposit( 0x7u, 0x1010100u );
+        constexpr unsigned r2 = boost::core::bit_extract( 0xFF00FF00u, 0x0FF0u );
+        constexpr int r3 = boost::core::select( 0x80000001u, 1 );
+
+        BOOST_TEST_EQ( r1, 0x1010100u );
+        BOOST_TEST_EQ( r2, 0xF0u );
+        BOOST_TEST_EQ( r3, 31 );
+    }
+
+#endif
+
+    boost::detail::splitmix64 rng;
+
+    test<unsigned char>( rng );
+    test<unsigned short>( rng );
+    test<unsigned int>( rng );
+    test<unsigned long>( rng );
+    test<boost::uint64_t>( rng );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,233 @@
+// Test for boost/core/bit.hpp (boost::uint128_type support)
+//
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/config.hpp>
+#include <boost/config/pragma_message.hpp>
+
+#if !defined(BOOST_HAS_INT128)
+
+BOOST_PRAGMA_MESSAGE( "Test skipped because BOOST_HAS_INT128 is not defined" )
+int main() {}
+
+#else
+
+#include <boost/core/bit.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/cstdint.hpp>
+
+typedef boost::uint128_type U;
+
+static U make( boost::uint64_t hi, boost::uint64_t lo )
+{
+    return static_cast<U>( hi ) << 64 | lo;
+}
+
+static boost::uint64_t w64( boost::uint32_t hi, boost::uint32_t lo )
+{
+    return static_cast<boost::uint64_t>( hi ) << 32 | lo;
+}
+
+static bool bit( U x, int i )
+{
+    return ( ( x >> i ) & 1 ) != 0;
+}
+
+static int ref_countl_zero( U x )
+{
+    int r = 0;
+    for( int i = 127; i >= 0 && !bit( x, i ); --i, ++r );
+    return r;
+}
+
+static int ref_countr_zero( U x )
+{
+    int r = 0;
+    for( int i = 0; i < 128 && !bit( x, i ); ++i, ++r );
+    return r;
+}
+
+static int ref_popcount( U x )
+{
+    int r = 0;
+    for( int i = 0; i < 128; ++i ) r += bit( x, i );
+    return r;
+}
+
+static U ref_deposit( U x, U mask )
+{
+    U r = 0;
+
+    for( int i = 0, j = 0; i < 128; ++i )
+    {
+        if( bit( mask, i ) )
+        {
+            if( bit( x, j ) ) r |= static_cast<U>( 1 ) << i;
+            ++j;
+        }
+    }
+
+    return r;
+}
+
+static U ref_extract( U x, U mask )
+{
+    U r = 0;
+
+    for( int i = 0, j = 0; i < 128; ++i )
+    {
+        if( bit( mask, i ) )
+        {
+            if( bit( x, i ) ) r |= static_cast<U>( 1 ) << j;
+            ++j;
+        }
+    }
+
+    return r;
+}
+
+static U random_value( boost::detail::splitmix64& rng )
+{
+    U x = make( rng(), rng() );
+
+    // clear a random number of the high or low bits, so that all
+    // bit counts are exercised
+
+    int const s = static_cast<int>( rng() % 128 );
+
+    switch( rng() % 3 )
+    {
+    case 0: x >>= s; break;
+    case 1: x <<= s; break;
+    default: break;
+    }
+
+    return x;
+}
+
+int main()
+{
+    using namespace boost::core;
+
+    U const one = 1;
+    U const all = ~static_cast<U>( 0 );
+
+    BOOST_TEST_EQ( countl_zero( static_cast<U>( 0 ) ), 128 );
+    BOOST_TEST_EQ( countr_zero( static_cast<U>( 0 ) ), 128 );
+    BOOST_TEST_EQ( countl_one( all ), 128 );
+    BOOST_TEST_EQ( countr_one( all ), 128 );
+    BOOST_TEST_EQ( popcount( all ), 128 );
+
+    BOOST_TEST( bit_ceil( static_cast<U>( 0 ) ) == 0 );
+    BOOST_TEST( bit_ceil( one ) == 1 );
+    BOOST_TEST( bit_ceil( make( 0, 1 ) + make( 1, 0 ) ) == make( 2, 0 ) );
+    BOOST_TEST( bit_ceil( one << 127 ) == one << 127 );
+    BOOST_TEST( bit_floor( static_cast<U>( 0 ) ) == 0 );
+    BOOST_TEST( bit_floor( all ) == one << 127 );
+    BOOST_TEST( bit_width( all ) == 128 );
+    BOOST_TEST( has_single_bit( one << 100 ) );
+    BOOST_TEST( !has_single_bit( ( one << 100 ) | 1 ) );
+
+    BOOST_TEST( rotl( one << 127, 1 ) == one );
+    BOOST_TEST( rotr( one, 1 ) == one << 127 );
+    BOOST_TEST( rotl( make( w64( 0x01234567, 0x89ABCDEF ), w64( 0xFEDCBA98, 0x76543210 ) ), 64 ) == make( w64( 0xFEDCBA98, 0x76543210 ), w64( 0x01234567, 0x89ABCDEF ) ) );
+
+    BOOST_TEST( byteswap( make( w64( 0x00010203, 0x04050607 ), w64( 0x08090A0B, 0x0C0D0E0F ) ) ) == make( w64( 0x0F0E0D0C, 0x0B0A0908 ), w64( 0x07060504, 0x03020100 ) ) );
+
+    {
+        unsigned char b[ 17 ];
+
+        U const x = make( w64( 0x00010203, 0x04050607 ), w64( 0x08090A0B, 0x0C0D0E0F ) );
+
+        store_be( b + 1, x );
+
+        BOOST_TEST_EQ( b[ 1 ], 0x00 );
+        BOOST_TEST_EQ( b[ 16 ], 0x0F );
+        BOOST_TEST( load_be<U>( b + 1 ) == x );
+        BOOST_TEST( load_le<U>( b + 1 ) == byteswap( x ) );
+
+        store_le( b + 1, x );
+
+        BOOST_TEST_EQ( b[ 1 ], 0x0F );
+        BOOST_TEST( load_le<U>( b + 1 ) == x );
+    }
+
+    BOOST_TEST_EQ( select( all, 127 ), 127 );
+    BOOST_TEST_EQ( select( one << 64, 0 ), 64 );
+    BOOST_TEST_EQ( select( one << 64, 1 ), 128 );
+
+    boost::detail::splitmix64 rng;
+
+    for( int i = 0; i < 5000; ++i )
+    {
+        U const x = random_value( rng );
+        U const m = random_value( rng );
+
+        int const s = static_cast<int>( rng() % 256 ) - 128;
+        int const k = static_cast<int>( rng() % 128 );
+
+        BOOST_TEST_EQ( countl_zero( x ), ref_countl_zero( x ) );
+        BOOST_TEST_EQ( countr_zero( x ), ref_countr_zero( x ) );
+        BOOST_TEST_EQ( countl_one( x ), ref_countl_zero( ~x ) );
+        BOOST_TEST_EQ( countr_one( x ), ref_countr_zero( ~x ) );
+        BOOST_TEST_EQ( popcount( x ), ref_popcount( x ) );
+
+        BOOST_TEST( rotr( rotl( x, s ), s ) == x );
+        BOOST_TEST( rotl( x, s ) == rotr( x, -s ) );
+
+        BOOST_TEST( bit_width( x ) == static_cast<U>( 128 - ref_countl_zero( x ) ) );
+
+        if( x != 0 )
+        {
+            BOOST_TEST( bit_floor( x ) == one << ( 127 - ref_countl_zero( x ) ) );
+        }
+
+        if( x > 1 && x <= one << 127 )
+        {
+            U const y = bit_ceil( x );
+
+            BOOST_TEST( has_single_bit( y ) );
+            BOOST_TEST( y >= x );
+            BOOST_TEST( ( y >> 1 ) < x );
+        }
+
+        BOOST_TEST( byteswap( byteswap( x ) ) == x );
+        BOOST_TEST( static_cast<boost::uint64_t>( byteswap( x ) ) == byteswap( static_cast<boost::uint64_t>( x >> 64 ) ) );
+
+        BOOST_TEST( bit_deposit( x, m ) == ref_deposit( x, m ) );
+        BOOST_TEST( bit_extract( x, m ) == ref_extract( x, m ) );
+
+        int const j = select( m, k );
+
+        if( k < ref_popcount( m ) )
+        {
+            BOOST_TEST( bit( m, j ) );
+            BOOST_TEST_EQ( popcount( static_cast<U>( m & ( ( one << j ) - 1 ) ) ), k );
+        }
+        else
+        {
+            BOOST_TEST_EQ( j, 128 );
+        }
+    }
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+
+    {
+        constexpr U r1 = bit_ceil( static_cast<U>( 1 ) << 70 | 1 );
+        constexpr int r2 = countl_zero( static_cast<U>( 1 ) << 70 );
+        constexpr U r3 = byteswap( static_cast<U>( 0xFF ) );
+
+        BOOST_TEST( r1 == one << 71 );
+        BOOST_TEST_EQ( r2, 57 );
+        BOOST_TEST( r3 == one * 0xFF << 120 );
+    }
+
+#endif
+
+    return boost::report_errors();
+}
+
+#endif
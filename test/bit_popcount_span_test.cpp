@@ -0,0 +1,95 @@
+// Test for boost/core/bit.hpp (popcount over a span)
+//
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/config.hpp>
+#include <boost/config/pragma_message.hpp>
+
+#if defined(BOOST_NO_CXX11_CONSTEXPR) || defined(BOOST_NO_CXX11_DECLTYPE)
+
+BOOST_PRAGMA_MESSAGE( "Test skipped because boost/core/span.hpp is not supported" )
+int main() {}
+
+#else
+
+#include <boost/core/bit.hpp>
+#include <boost/core/span.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/cstdint.hpp>
+#include <vector>
+#include <cstddef>
+
+template<class T> std::size_t ref_popcount( std::vector<T> const& v, std::size_t first, std::size_t n )
+{
+    std::size_t r = 0;
+
+    for( std::size_t i = first; i < first + n; ++i )
+    {
+        for( T x = v[ i ]; x; x &= x - 1, ++r );
+    }
+
+    return r;
+}
+
+template<class T> void test( boost::detail::splitmix64& rng )
+{
+    // sizes around the 32, 64, 128 and 512 byte blocks, at every
+    // alignment of the first word
+
+    std::vector<T> v( 2048 / sizeof( T ) + 16 );
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        v[ i ] = static_cast<T>( rng() );
+    }
+
+    for( std::size_t n = 0; n <= 2048 / sizeof( T ); n = n < 80? n + 1: n * 2 - 1 )
+    {
+        for( std::size_t first = 0; first < 8; ++first )
+        {
+            boost::span<T const> s( v.data() + first, n );
+            BOOST_TEST_EQ( boost::core::popcount( s ), ref_popcount( v, first, n ) );
+        }
+    }
+
+    {
+        boost::span<T> s( v.data(), v.size() );
+        BOOST_TEST_EQ( boost::core::popcount( s ), ref_popcount( v, 0, v.size() ) );
+    }
+
+    {
+        std::vector<T> w( 4096 / sizeof( T ) + 3, static_cast<T>( -1 ) );
+        BOOST_TEST_EQ( boost::core::popcount( boost::span<T const>( w.data(), w.size() ) ), w.size() * sizeof( T ) * 8 );
+    }
+}
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+
+constexpr boost::uint64_t cx[] = { 1, 3, 7, 0xFFFFFFFFFFFFFFFFull };
+
+static_assert( boost::core::popcount( boost::span<boost::uint64_t const>( cx ) ) == 70, "popcount( span )" );
+
+#endif
+
+int main()
+{
+    boost::detail::splitmix64 rng;
+
+    test<unsigned char>( rng );
+    test<unsigned short>( rng );
+    test<unsigned int>( rng );
+    test<unsigned long>( rng );
+    test<boost::ulong_long_type>( rng );
+
+    {
+        boost::uint32_t const a[ 3 ] = { 1, 2, 0x80000001u };
+        BOOST_TEST_EQ( boost::core::popcount( boost::span<boost::uint32_t const, 3>( a ) ), 4u );
+    }
+
+    return boost::report_errors();
+}
+
+#endif
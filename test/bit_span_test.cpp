@@ -0,0 +1,213 @@
+// Test for boost/core/bit_span.hpp
+//
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/config.hpp>
+#include <boost/config/pragma_message.hpp>
+
+#if defined(BOOST_NO_CXX11_CONSTEXPR) || defined(BOOST_NO_CXX11_DECLTYPE)
+
+BOOST_PRAGMA_MESSAGE( "Test skipped because boost/core/span.hpp is not supported" )
+int main() {}
+
+#else
+
+#include <boost/core/bit_span.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/cstdint.hpp>
+#include <vector>
+#include <cstddef>
+
+using boost::core::bit_span;
+using boost::core::const_bit_span;
+
+std::size_t const npos = bit_span::npos;
+
+static std::vector<bool> to_bits( const_bit_span s )
+{
+    std::vector<bool> r( s.size() );
+
+    for( std::size_t i = 0; i < s.size(); ++i )
+    {
+        r[ i ] = s[ i ];
+    }
+
+    return r;
+}
+
+static std::vector<boost::uint64_t> random_words( boost::detail::splitmix64& rng, std::size_t n )
+{
+    std::vector<boost::uint64_t> v( n );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        // sparse words, so that find_next skips over zero words
+
+        switch( rng() % 3 )
+        {
+        case 0: v[ i ] = 0; break;
+        case 1: v[ i ] = rng() & rng() & rng(); break;
+        default: v[ i ] = rng(); break;
+        }
+    }
+
+    return v;
+}
+
+int main()
+{
+    {
+        bit_span s;
+
+        BOOST_TEST( s.empty() );
+        BOOST_TEST_EQ( s.size(), 0u );
+        BOOST_TEST_EQ( s.count(), 0u );
+        BOOST_TEST_EQ( s.find_first(), npos );
+        BOOST_TEST_EQ( s.rank( 0 ), 0u );
+        BOOST_TEST( s.none() );
+        BOOST_TEST( s.all() );
+    }
+
+    {
+        boost::uint64_t w[ 3 ] = {};
+
+        boost::span<boost::uint64_t, 3> ws( w );
+        bit_span s( ws );
+
+        BOOST_TEST_EQ( s.size(), 192u );
+        BOOST_TEST( s.none() );
+
+        s.set( 0 );
+        s.set( 64 );
+        s.set( 191 );
+
+        BOOST_TEST_EQ( w[ 0 ], 1u );
+        BOOST_TEST_EQ( w[ 1 ], 1u );
+        BOOST_TEST_EQ( w[ 2 ], static_cast<boost::uint64_t>( 1 ) << 63 );
+
+        BOOST_TEST_EQ( s.find_first(), 0u );
+        BOOST_TEST_EQ( s.find_next( 0 ), 64u );
+        BOOST_TEST_EQ( s.find_next( 64 ), 191u );
+        BOOST_TEST_EQ( s.find_next( 191 ), npos );
+        BOOST_TEST_EQ( s.find_next( 1000 ), npos );
+
+        BOOST_TEST_EQ( s.rank( 0 ), 0u );
+        BOOST_TEST_EQ( s.rank( 1 ), 1u );
+        BOOST_TEST_EQ( s.rank( 64 ), 1u );
+        BOOST_TEST_EQ( s.rank( 65 ), 2u );
+        BOOST_TEST_EQ( s.rank( 192 ), 3u );
+
+        s.set( 5, true );
+        s.set( 0, false );
+        s.flip( 6 );
+        s.reset( 64 );
+
+        BOOST_TEST_EQ( w[ 0 ], 0x60u );
+        BOOST_TEST_EQ( w[ 1 ], 0u );
+        BOOST_TEST_EQ( s.count(), 3u );
+
+        s.set();
+        BOOST_TEST( s.all() );
+        BOOST_TEST_EQ( s.count(), 192u );
+
+        s.reset( 130 );
+        BOOST_TEST( !s.all() );
+        BOOST_TEST( s.any() );
+
+        s.set();
+        s.flip();
+        BOOST_TEST( s.none() );
+    }
+
+    boost::detail::splitmix64 rng;
+
+    for( int i = 0; i < 500; ++i )
+    {
+        std::size_t const n = static_cast<std::size_t>( rng() % 40 );
+
+        std::vector<boost::uint64_t> va = random_words( rng, n );
+        std::vector<boost::uint64_t> vb = random_words( rng, n );
+
+        bit_span a( va.data(), n );
+        boost::span<boost::uint64_t const> wb( vb );
+        const_bit_span b( wb );
+
+        std::vector<bool> const ba = to_bits( a );
+        std::vector<bool> const bb = to_bits( b );
+
+        // queries
+
+        std::size_t count = 0;
+        bool intersects = false, subset = true;
+
+        for( std::size_t j = 0; j < a.size(); ++j )
+        {
+            BOOST_TEST_EQ( a.rank( j ), count );
+
+            count += ba[ j ];
+            intersects = intersects || ( ba[ j ] && bb[ j ] );
+            subset = subset && ( !ba[ j ] || bb[ j ] );
+        }
+
+        BOOST_TEST_EQ( a.rank( a.size() ), count );
+        BOOST_TEST_EQ( a.count(), count );
+        BOOST_TEST_EQ( a.any(), count != 0 );
+        BOOST_TEST_EQ( a.all(), count == a.size() );
+        BOOST_TEST_EQ( a.intersects( b ), intersects );
+        BOOST_TEST_EQ( a.is_subset_of( b ), subset );
+        BOOST_TEST( a.equals( a ) );
+
+        // find_first and find_next visit the set bits in order
+
+        {
+            std::size_t j = a.find_first();
+
+            for( std::size_t k = 0; k < a.size(); ++k )
+            {
+                if( ba[ k ] )
+                {
+                    BOOST_TEST_EQ( j, k );
+                    j = a.find_next( j );
+                }
+            }
+
+            BOOST_TEST_EQ( j, npos );
+        }
+
+        // set operations
+
+        std::vector<boost::uint64_t> vc( n );
+        bit_span c( vc.data(), n );
+
+        c.assign( a );
+        BOOST_TEST( c.equals( a ) );
+
+        c &= b;
+        for( std::size_t j = 0; j < c.size(); ++j ) BOOST_TEST_EQ( c[ j ], ba[ j ] && bb[ j ] );
+
+        c.assign( a );
+        c |= b;
+        for( std::size_t j = 0; j < c.size(); ++j ) BOOST_TEST_EQ( c[ j ], ba[ j ] || bb[ j ] );
+
+        c.assign( a );
+        c ^= b;
+        for( std::size_t j = 0; j < c.size(); ++j ) BOOST_TEST_EQ( c[ j ], ba[ j ] != bb[ j ] );
+
+        c.assign( a );
+        c -= b;
+        for( std::size_t j = 0; j < c.size(); ++j ) BOOST_TEST_EQ( c[ j ], ba[ j ] && !bb[ j ] );
+
+        BOOST_TEST( c.is_subset_of( a ) );
+        BOOST_TEST( !c.intersects( b ) || c.none() );
+
+        a ^= a;
+        BOOST_TEST( a.none() );
+    }
+
+    return boost::report_errors();
+}
+
+#endif
@@ -6,6 +6,7 @@ Distributed under the Boost Software License, Version 1.0.
 (http://www.boost.org/LICENSE_1_0.txt)
 */
 #include <boost/core/default_allocator.hpp>
+#include <boost/core/allocator_access.hpp>
 #include <boost/core/lightweight_test_trait.hpp>
 #include <vector>
 #include <list>
@@ -208,6 +209,49 @@ void test_allocate_deallocate()
     test_allocate<int[5]>();
 }
 
+template<class T>
+void test_allocate_at_least()
+{
+    boost::default_allocator<T> a;
+    for (std::size_t n = 0; n < 50; ++n) {
+        boost::allocation_result<T*> r = a.allocate_at_least(n);
+        BOOST_TEST(r.ptr != 0);
+        BOOST_TEST_GE(r.count, n);
+        a.deallocate(r.ptr, r.count);
+    }
+}
+
+void test_allocate_at_least_deallocate()
+{
+    test_allocate_at_least<int>();
+    test_allocate_at_least<type>();
+    test_allocate_at_least<int[5]>();
+    boost::default_allocator<char> a;
+    boost::allocation_result<char*> r = a.allocate_at_least(1);
+    BOOST_TEST_GE(r.count, 1);
+    for (std::size_t i = 0; i < r.count; ++i) {
+        r.ptr[i] = 'x';
+    }
+    a.deallocate(r.ptr, r.count);
+}
+
+void test_expand_reallocate()
+{
+    boost::default_allocator<int> a;
+    boost::allocation_result<int*> r = a.allocate_at_least(3);
+#if defined(BOOST_CORE_USE_MALLOC_USABLE_SIZE) && defined(__GLIBC__)
+    BOOST_TEST(boost::allocator_expand(a, r.ptr, 3, r.count));
+#endif
+    BOOST_TEST(!boost::allocator_expand(a, r.ptr, 3, a.max_size() + 1));
+    r.ptr[2] = 2;
+    int* p = boost::allocator_reallocate(a, r.ptr, r.count, 100000, 3);
+    BOOST_TEST_EQ(p[2], 2);
+    p[99999] = 1;
+    p = boost::allocator_reallocate(a, p, 100000, 10, 3);
+    BOOST_TEST_EQ(p[2], 2);
+    a.deallocate(p, 10);
+}
+
 void test_equals()
 {
     BOOST_TEST(boost::default_allocator<int>() ==
@@ -261,6 +305,8 @@ int main()
     test_construct_other();
     test_max_size();
     test_allocate_deallocate();
+    test_allocate_at_least_deallocate();
+    test_expand_reallocate();
     test_equals();
     test_not_equals();
     test_container();
@@ -0,0 +1,157 @@
+/*
+Copyright 2026
+
+Distributed under the Boost Software License, Version 1.0.
+(http://www.boost.org/LICENSE_1_0.txt)
+*/
+#include <boost/core/hugepage_allocator.hpp>
+#include <boost/core/allocator_access.hpp>
+#include <boost/core/allocator_traits.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <list>
+
+struct S {
+    explicit S(int v)
+        : v(v) { }
+
+    long double d;
+    int v;
+};
+
+bool
+is_aligned(const void* p, std::size_t n)
+{
+    return reinterpret_cast<std::size_t>(p) % n == 0;
+}
+
+template<std::size_t N>
+void test_alignment()
+{
+    boost::hugepage_allocator<char, N> a;
+    for (std::size_t n = 0; n < 200; n += 7) {
+        char* p = a.allocate(n);
+        BOOST_TEST(is_aligned(p, N));
+        for (std::size_t i = 0; i < n; ++i) {
+            p[i] = static_cast<char>(i);
+        }
+        a.deallocate(p, n);
+    }
+    boost::hugepage_allocator<S, N> s;
+    S* q = s.allocate(3);
+    BOOST_TEST(is_aligned(q, N));
+    BOOST_TEST(is_aligned(q, boost::detail::hp_align_of<S>::value));
+    s.deallocate(q, 3);
+}
+
+void test_default()
+{
+    boost::hugepage_allocator<S> a;
+    S* p = a.allocate(5);
+    BOOST_TEST(is_aligned(p, boost::detail::hp_align_of<S>::value));
+    ::new(static_cast<void*>(p + 4)) S(4);
+    BOOST_TEST_EQ(p[4].v, 4);
+    a.deallocate(p, 5);
+    boost::allocation_result<S*> r = a.allocate_at_least(5);
+    BOOST_TEST_EQ(r.count, 5);
+    a.deallocate(r.ptr, r.count);
+}
+
+void test_large()
+{
+    const std::size_t n = 3 * 1024 * 1024;
+    boost::hugepage_allocator<char, 64> a;
+    char* p = a.allocate(n);
+    p[0] = 1;
+    p[n - 1] = 1;
+#if defined(BOOST_CORE_HUGEPAGE_ALLOCATOR_MMAP)
+    BOOST_TEST(is_aligned(p, boost::detail::hp_size));
+#else
+    BOOST_TEST(is_aligned(p, 64));
+#endif
+    a.deallocate(p, n);
+    boost::allocation_result<char*> r =
+        boost::allocator_allocate_at_least(a, n);
+    BOOST_TEST_GE(r.count, n);
+#if defined(BOOST_CORE_HUGEPAGE_ALLOCATOR_MMAP)
+    BOOST_TEST_EQ(r.count, 4 * 1024 * 1024);
+#endif
+    r.ptr[r.count - 1] = 1;
+    a.deallocate(r.ptr, r.count);
+    boost::hugepage_allocator<double, 4194304> b;
+    double* q = b.allocate(n);
+    BOOST_TEST(is_aligned(q, 4194304));
+    q[n - 1] = 1;
+    b.deallocate(q, n);
+}
+
+void test_expand()
+{
+    const std::size_t n = 3 * 1024 * 1024;
+    boost::hugepage_allocator<char> a;
+    char* p = a.allocate(n);
+    p[n - 1] = 1;
+#if defined(BOOST_CORE_HUGEPAGE_ALLOCATOR_MMAP)
+    BOOST_TEST(a.expand(p, n, 4 * 1024 * 1024));
+#endif
+    BOOST_TEST(!a.expand(p, n, n - 1));
+    BOOST_TEST(!boost::allocator_expand(a, p, n, a.max_size() + 1));
+    std::size_t m = n;
+    if (boost::allocator_expand(a, p, n, 64 * 1024 * 1024)) {
+        m = 64 * 1024 * 1024;
+        p[m - 1] = 1;
+    }
+    BOOST_TEST_EQ(p[n - 1], 1);
+    a.deallocate(p, m);
+    char* q = a.allocate(100);
+    BOOST_TEST(!boost::allocator_expand(a, q, 100, 200));
+    a.deallocate(q, 100);
+}
+
+void test_access()
+{
+    typedef boost::hugepage_allocator<int, 64> A;
+    A a;
+    BOOST_TEST_EQ(boost::allocator_max_size(a), a.max_size());
+    BOOST_TEST(boost::allocator_max_size(a) > 0);
+    int* p = boost::allocator_allocate(a, 3);
+    BOOST_TEST(is_aligned(p, 64));
+    boost::allocator_construct(a, p, 5);
+    BOOST_TEST_EQ(*p, 5);
+    boost::allocator_destroy(a, p);
+    boost::allocator_deallocate(a, p, 3);
+    p = boost::allocator_traits<A>::allocate(a, 4);
+    BOOST_TEST(is_aligned(p, 64));
+    boost::allocator_traits<A>::deallocate(a, p, 4);
+    boost::allocator_rebind<A, S>::type s(a);
+    BOOST_TEST(s == a);
+    BOOST_TEST(!(s != a));
+}
+
+void test_containers()
+{
+    std::vector<double, boost::hugepage_allocator<double, 64> > v;
+    for (int i = 0; i < 1000; ++i) {
+        v.push_back(i);
+        BOOST_TEST(is_aligned(&v[0], 64));
+    }
+    BOOST_TEST_EQ(v[999], 999);
+    std::list<S, boost::hugepage_allocator<S, 128> > l;
+    for (int i = 0; i < 100; ++i) {
+        l.push_back(S(i));
+    }
+    BOOST_TEST_EQ(l.back().v, 99);
+}
+
+int main()
+{
+    test_alignment<1>();
+    test_alignment<64>();
+    test_alignment<4096>();
+    test_default();
+    test_large();
+    test_expand();
+    test_access();
+    test_containers();
+    return boost::report_errors();
+}
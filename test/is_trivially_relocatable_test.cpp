@@ -0,0 +1,52 @@
+/*
+Copyright 2026
+
+Distributed under the Boost Software License, Version 1.0.
+(http://www.boost.org/LICENSE_1_0.txt)
+*/
+#include <boost/core/is_trivially_relocatable.hpp>
+#include <boost/core/lightweight_test_trait.hpp>
+#include <string>
+
+struct P {
+    int x;
+    double y;
+};
+
+struct N {
+    N(const N&) { }
+};
+
+struct U {
+    int* p;
+
+    ~U() {
+        delete p;
+    }
+};
+
+namespace boost {
+
+template<>
+struct is_trivially_relocatable<U> {
+    BOOST_STATIC_CONSTEXPR bool value = true;
+};
+
+} /* boost */
+
+int main()
+{
+#if !defined(BOOST_NO_CXX11_HDR_TYPE_TRAITS) && \
+    !(defined(BOOST_LIBSTDCXX_VERSION) && BOOST_LIBSTDCXX_VERSION < 50000)
+    BOOST_TEST_TRAIT_TRUE((boost::is_trivially_relocatable<int>));
+    BOOST_TEST_TRAIT_TRUE((boost::is_trivially_relocatable<const int>));
+    BOOST_TEST_TRAIT_TRUE((boost::is_trivially_relocatable<int*>));
+    BOOST_TEST_TRAIT_TRUE((boost::is_trivially_relocatable<P>));
+    BOOST_TEST_TRAIT_TRUE((boost::is_trivially_relocatable<P[4]>));
+    BOOST_TEST_TRAIT_FALSE((boost::is_trivially_relocatable<volatile int>));
+#endif
+    BOOST_TEST_TRAIT_FALSE((boost::is_trivially_relocatable<N>));
+    BOOST_TEST_TRAIT_FALSE((boost::is_trivially_relocatable<std::string>));
+    BOOST_TEST_TRAIT_TRUE((boost::is_trivially_relocatable<U>));
+    return boost::report_errors();
+}
@@ -0,0 +1,156 @@
+/*
+Copyright 2026
+
+Distributed under the Boost Software License, Version 1.0.
+(http://www.boost.org/LICENSE_1_0.txt)
+*/
+#include <boost/core/monotonic_allocator.hpp>
+#include <boost/core/allocator_access.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <list>
+#include <map>
+
+struct S {
+    explicit S(int v)
+        : v(v) { }
+
+    long double d;
+    int v;
+};
+
+bool
+is_aligned(const void* p, std::size_t n)
+{
+    return reinterpret_cast<std::size_t>(p) % n == 0;
+}
+
+bool
+in_range(const void* p, const void* b, std::size_t n)
+{
+    return static_cast<const char*>(p) >=
+        static_cast<const char*>(b) &&
+        static_cast<const char*>(p) < static_cast<const char*>(b) + n;
+}
+
+void test_allocate()
+{
+    boost::monotonic_arena r;
+    boost::monotonic_allocator<int> a(r);
+    int* p1 = a.allocate(1);
+    int* p2 = a.allocate(3);
+    BOOST_TEST(p1 != 0);
+    BOOST_TEST(p2 == p1 + 1);
+    BOOST_TEST(is_aligned(p1, sizeof(int)));
+    a.deallocate(p2, 3);
+    int* p3 = a.allocate(1);
+    BOOST_TEST(p3 == p2 + 3);
+    boost::monotonic_allocator<char> c(a);
+    char* q = c.allocate(1);
+    boost::monotonic_allocator<S> s(c);
+    S* t = s.allocate(2);
+    BOOST_TEST(is_aligned(t, boost::detail::mono_align_of<S>::value));
+    BOOST_TEST(reinterpret_cast<char*>(t) > q);
+}
+
+void test_buffer()
+{
+    char b[256];
+    boost::monotonic_arena r(b + 1, sizeof b - 1);
+    boost::monotonic_allocator<double> a(r);
+    double* p = a.allocate(4);
+    BOOST_TEST(in_range(p, b, sizeof b));
+    BOOST_TEST(is_aligned(p, boost::detail::mono_align_of<double>::value));
+    double* q = a.allocate(40);
+    BOOST_TEST(!in_range(q, b, sizeof b));
+    BOOST_TEST(is_aligned(q, boost::detail::mono_align_of<double>::value));
+    r.reset();
+    BOOST_TEST_EQ(r.remaining(), sizeof b - 1);
+    BOOST_TEST(a.allocate(4) == p);
+}
+
+void test_blocks()
+{
+    boost::monotonic_arena r(64);
+    boost::monotonic_allocator<char> a(r);
+    char* p = a.allocate(64);
+    BOOST_TEST_EQ(r.remaining(), 0);
+    p[63] = 1;
+    char* q = a.allocate(1);
+    BOOST_TEST(q != p + 64);
+    BOOST_TEST_EQ(r.remaining(), 127);
+    char* l = a.allocate(10000);
+    l[9999] = 1;
+    BOOST_TEST_EQ(r.remaining(), 0);
+    for (int i = 0; i < 1000; ++i) {
+        char* x = a.allocate(i);
+        if (i > 0) {
+            x[i - 1] = 1;
+        }
+    }
+    r.reset();
+    BOOST_TEST_EQ(r.remaining(), 0);
+    a.allocate(1);
+    BOOST_TEST_EQ(r.remaining(), 63);
+}
+
+void test_access()
+{
+    boost::monotonic_arena r;
+    boost::monotonic_allocator<int> a(r);
+    int* p = boost::allocator_allocate(a, 3);
+    boost::allocator_construct(a, p, 5);
+    BOOST_TEST_EQ(*p, 5);
+    boost::allocator_destroy(a, p);
+    boost::allocator_deallocate(a, p, 3);
+    BOOST_TEST(boost::allocator_max_size(a) > 0);
+    boost::allocator_rebind<boost::monotonic_allocator<int>, S>::type s(a);
+    BOOST_TEST(s == a);
+    boost::monotonic_arena r2;
+    BOOST_TEST(boost::monotonic_allocator<int>(r2) != a);
+    BOOST_TEST(&s.arena() == &r);
+}
+
+void test_containers()
+{
+    char b[512];
+    boost::monotonic_arena r(b, sizeof b);
+    {
+        std::vector<int, boost::monotonic_allocator<int> >
+            v((boost::monotonic_allocator<int>(r)));
+        for (int i = 0; i < 1000; ++i) {
+            v.push_back(i);
+        }
+        BOOST_TEST_EQ(v.size(), 1000);
+        BOOST_TEST_EQ(v[999], 999);
+    }
+    {
+        std::list<S, boost::monotonic_allocator<S> >
+            l((boost::monotonic_allocator<S>(r)));
+        for (int i = 0; i < 1000; ++i) {
+            l.push_back(S(i));
+        }
+        BOOST_TEST_EQ(l.back().v, 999);
+    }
+    r.reset();
+    {
+        typedef std::map<int, int, std::less<int>,
+            boost::monotonic_allocator<std::pair<const int, int> > > map;
+        map m((std::less<int>()),
+            boost::monotonic_allocator<std::pair<const int, int> >(r));
+        for (int i = 0; i < 1000; ++i) {
+            m[i] = i * 2;
+        }
+        BOOST_TEST_EQ(m[500], 1000);
+    }
+}
+
+int main()
+{
+    test_allocate();
+    test_buffer();
+    test_blocks();
+    test_access();
+    test_containers();
+    return boost::report_errors();
+}
@@ -0,0 +1,323 @@
+/*
+Copyright 2026
+
+Distributed under the Boost Software License, Version 1.0.
+(http://www.boost.org/LICENSE_1_0.txt)
+*/
+#include <boost/core/noinit_buffer.hpp>
+#include <boost/core/default_allocator.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstring>
+#include <stdexcept>
+
+template<class T>
+struct A {
+    typedef T value_type;
+
+    static int allocated;
+
+    explicit A(int id)
+        : id(id) { }
+
+    template<class U>
+    A(const A<U>& other)
+        : id(other.id) { }
+
+    T* allocate(std::size_t n) {
+        allocated += static_cast<int>(n);
+        return static_cast<T*>(::operator new(sizeof(T) * n));
+    }
+
+    void deallocate(T* p, std::size_t n) {
+        allocated -= static_cast<int>(n);
+        ::operator delete(p);
+    }
+
+    int id;
+};
+
+template<class T>
+int A<T>::allocated = 0;
+
+template<class T, class U>
+bool
+operator==(const A<T>& lhs, const A<U>& rhs)
+{
+    return lhs.id == rhs.id;
+}
+
+template<class T, class U>
+bool
+operator!=(const A<T>& lhs, const A<U>& rhs)
+{
+    return lhs.id != rhs.id;
+}
+
+typedef boost::core::noinit_buffer<char, 16, A<char> > buffer;
+
+struct yes {
+    static const bool value = true;
+};
+
+template<class T>
+struct B
+    : A<T> {
+    typedef yes propagate_on_container_swap;
+
+    template<class U>
+    struct rebind {
+        typedef B<U> other;
+    };
+
+    explicit B(int id)
+        : A<T>(id) { }
+
+    template<class U>
+    B(const B<U>& other)
+        : A<T>(other.id) { }
+};
+
+std::size_t
+fill(char* p, std::size_t n, int& next)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        p[i] = static_cast<char>(next++);
+    }
+    return n;
+}
+
+bool
+check(const buffer& b)
+{
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        if (b[i] != static_cast<char>(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void test_local()
+{
+    buffer b((A<char>(1)));
+    BOOST_TEST(b.empty());
+    BOOST_TEST_EQ(b.capacity(), 16);
+    const char* p = b.data();
+    b.resize(10);
+    BOOST_TEST_EQ(b.size(), 10);
+    BOOST_TEST(b.data() == p);
+    b.resize(3);
+    BOOST_TEST_EQ(b.size(), 3);
+    BOOST_TEST_EQ(b.capacity(), 16);
+    b.reserve_at_least(16);
+    BOOST_TEST(b.data() == p);
+    BOOST_TEST_EQ(A<char>::allocated, 0);
+    BOOST_TEST(b.get_allocator() == A<char>(1));
+    b.clear();
+    BOOST_TEST(b.empty());
+    BOOST_TEST(b.begin() == b.end());
+}
+
+void test_prepare_commit()
+{
+    {
+        buffer b((A<char>(1)));
+        int next = 0;
+        for (int i = 0; i < 100; ++i) {
+            std::size_t n = static_cast<std::size_t>(i % 7 + 1);
+            char* p = b.prepare(n);
+            BOOST_TEST_GE(b.capacity() - b.size(), n);
+            b.commit(fill(p, n - (i % 2), next));
+        }
+        BOOST_TEST_EQ(b.size(), static_cast<std::size_t>(next));
+        BOOST_TEST(check(b));
+        BOOST_TEST_GT(A<char>::allocated, 0);
+        BOOST_TEST_EQ(static_cast<std::size_t>(A<char>::allocated),
+            b.capacity());
+    }
+    BOOST_TEST_EQ(A<char>::allocated, 0);
+}
+
+void test_reserve_resize()
+{
+    buffer b((A<char>(1)));
+    b.reserve_at_least(100);
+    BOOST_TEST_EQ(b.capacity(), 100);
+    b.reserve_at_least(50);
+    BOOST_TEST_EQ(b.capacity(), 100);
+    b.resize(101);
+    BOOST_TEST_EQ(b.capacity(), 101);
+    b.resize(0);
+    BOOST_TEST_EQ(b.capacity(), 101);
+    BOOST_TEST_EQ(A<char>::allocated, 101);
+    boost::core::noinit_buffer<int> c(1);
+    BOOST_TEST_THROWS(c.reserve_at_least(c.max_size() + 1),
+        std::length_error);
+    BOOST_TEST_THROWS(c.prepare(c.max_size()), std::length_error);
+    buffer d(40, A<char>(2));
+    BOOST_TEST_EQ(d.size(), 40);
+}
+
+void test_append()
+{
+    buffer b((A<char>(1)));
+    const char s[] = "0123456789";
+    b.append(s, 10);
+    b.append(b.data(), 10);
+    b.append(b.data() + 5, 15);
+    BOOST_TEST_EQ(b.size(), 35);
+    BOOST_TEST(std::memcmp(b.data(), "01234567890123456789"
+        "567890123456789", 35) == 0);
+    b.append(s, 0);
+    BOOST_TEST_EQ(b.size(), 35);
+}
+
+void test_copy()
+{
+    int next = 0;
+    buffer a((A<char>(1)));
+    a.commit(fill(a.prepare(8), 8, next));
+    buffer b(a);
+    BOOST_TEST_EQ(b.size(), 8);
+    BOOST_TEST(check(b));
+    a.commit(fill(a.prepare(100), 100, next));
+    b = a;
+    BOOST_TEST_EQ(b.size(), 108);
+    BOOST_TEST(check(b));
+    BOOST_TEST(b.data() != a.data());
+    b = b;
+    BOOST_TEST(check(b));
+    buffer c((A<char>(1)));
+    c = b;
+    BOOST_TEST(check(c));
+}
+
+#if !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+void test_move()
+{
+    int next = 0;
+    buffer a((A<char>(1)));
+    a.commit(fill(a.prepare(100), 100, next));
+    const char* p = a.data();
+    buffer b(std::move(a));
+    BOOST_TEST(b.data() == p);
+    BOOST_TEST_EQ(b.size(), 100);
+    BOOST_TEST(a.empty());
+    BOOST_TEST_EQ(a.capacity(), 16);
+    buffer c((A<char>(1)));
+    c = std::move(b);
+    BOOST_TEST(c.data() == p);
+    BOOST_TEST(check(c));
+    buffer d((A<char>(2)));
+    d = std::move(c);
+    BOOST_TEST(d.data() != p);
+    BOOST_TEST(check(d));
+    BOOST_TEST(d.get_allocator() == A<char>(2));
+    next = 0;
+    buffer e((A<char>(1)));
+    e.commit(fill(e.prepare(5), 5, next));
+    buffer f(std::move(e));
+    BOOST_TEST_EQ(f.size(), 5);
+    BOOST_TEST(check(f));
+    BOOST_TEST(e.empty());
+}
+#endif
+
+void test_swap()
+{
+    int next = 0;
+    buffer a((A<char>(1)));
+    a.commit(fill(a.prepare(4), 4, next));
+    buffer b((A<char>(1)));
+    b.commit(fill(b.prepare(9), 9, next));
+    swap(a, b);
+    BOOST_TEST_EQ(a.size(), 9);
+    BOOST_TEST_EQ(a[0], 4);
+    BOOST_TEST_EQ(b.size(), 4);
+    BOOST_TEST_EQ(b[3], 3);
+    buffer c((A<char>(1)));
+    c.commit(fill(c.prepare(50), 50, next));
+    const char* p = c.data();
+    a.swap(c);
+    BOOST_TEST(a.data() == p);
+    BOOST_TEST_EQ(a.size(), 50);
+    BOOST_TEST_EQ(c.size(), 9);
+    BOOST_TEST_EQ(c[8], 12);
+    c.swap(a);
+    BOOST_TEST(c.data() == p);
+    BOOST_TEST_EQ(a[0], 4);
+    buffer d((A<char>(1)));
+    d.reserve_at_least(30);
+    d.swap(c);
+    BOOST_TEST(d.data() == p);
+    BOOST_TEST_EQ(c.size(), 0);
+    BOOST_TEST_EQ(c.capacity(), 30);
+}
+
+void test_swap_allocator()
+{
+    typedef boost::core::noinit_buffer<char, 16, B<char> > type;
+    int next = 0;
+    {
+        type a((B<char>(1)));
+        a.commit(fill(a.prepare(40), 40, next));
+        type b((B<char>(2)));
+        b.commit(fill(b.prepare(3), 3, next));
+        a.swap(b);
+        BOOST_TEST(a.get_allocator() == B<char>(2));
+        BOOST_TEST(b.get_allocator() == B<char>(1));
+        BOOST_TEST_EQ(a.size(), 3);
+        BOOST_TEST_EQ(a[0], 40);
+        BOOST_TEST_EQ(b.size(), 40);
+        BOOST_TEST_EQ(b[39], 39);
+        swap(a, b);
+        BOOST_TEST(a.get_allocator() == B<char>(1));
+        BOOST_TEST_EQ(a.size(), 40);
+    }
+    BOOST_TEST_EQ(A<char>::allocated, 0);
+}
+
+struct P {
+    int x;
+    double y;
+};
+
+void test_types()
+{
+    boost::core::noinit_buffer<P, 4> a;
+    a.resize(3);
+    a[2].x = 1;
+    a.resize(1000);
+    BOOST_TEST_EQ(a[2].x, 1);
+    boost::core::noinit_buffer<int, 0> b;
+    BOOST_TEST_EQ(b.capacity(), 0);
+    b.resize(1);
+    BOOST_TEST_GE(b.capacity(), 1);
+    boost::core::noinit_buffer<unsigned char, 64,
+        boost::default_allocator<unsigned char> > c;
+    c.resize(1 << 20);
+    BOOST_TEST_GE(c.capacity(), 1U << 20);
+    c[(1 << 20) - 1] = 1;
+    unsigned char* p = c.prepare(1);
+    *p = 2;
+    c.commit(1);
+    BOOST_TEST_EQ(c[1 << 20], 2);
+    boost::core::noinit_buffer<char> d;
+    BOOST_TEST_EQ(d.capacity(), 256);
+}
+
+int main()
+{
+    test_local();
+    test_prepare_commit();
+    test_reserve_resize();
+    test_append();
+    test_copy();
+#if !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    test_move();
+#endif
+    test_swap();
+    test_swap_allocator();
+    test_types();
+    return boost::report_errors();
+}
@@ -0,0 +1,110 @@
+/*
+Copyright 2026
+
+Distributed under the Boost Software License, Version 1.0.
+(http://www.boost.org/LICENSE_1_0.txt)
+*/
+#include <boost/core/numa_allocator.hpp>
+#include <boost/core/allocator_access.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <list>
+
+#if defined(BOOST_CORE_NUMA_ALLOCATOR_MBIND) && defined(SYS_get_mempolicy)
+int
+preferred_node(void* p)
+{
+    int mode = -1;
+    unsigned long mask[16] = { 0 };
+    if (::syscall(SYS_get_mempolicy, &mode, mask, 1025UL, p, 2U) != 0 ||
+        mode != 1) {
+        return -1;
+    }
+    for (int i = 0; i < 1024; ++i) {
+        if (mask[i / (sizeof(unsigned long) * 8)] &
+            (1UL << (i % (sizeof(unsigned long) * 8)))) {
+            return i;
+        }
+    }
+    return -1;
+}
+#endif
+
+void test_allocate()
+{
+    boost::numa_allocator<char> a;
+    BOOST_TEST_EQ(a.node(), -1);
+    for (std::size_t n = 1; n < 100000; n *= 3) {
+        char* p = a.allocate(n);
+        p[0] = 1;
+        p[n - 1] = 1;
+        a.deallocate(p, n);
+    }
+    boost::numa_allocator<double> b(5000);
+    double* p = b.allocate(10000);
+    p[9999] = 1;
+    b.deallocate(p, 10000);
+}
+
+void test_node()
+{
+    int n = boost::numa_current_node();
+#if defined(BOOST_CORE_NUMA_ALLOCATOR_MBIND)
+    BOOST_TEST_GE(n, 0);
+#else
+    BOOST_TEST_EQ(n, -1);
+#endif
+    if (n < 0) {
+        return;
+    }
+    boost::numa_allocator<int> a(n);
+    int* p = a.allocate(1 << 16);
+    p[0] = 1;
+#if defined(BOOST_CORE_NUMA_ALLOCATOR_MBIND) && defined(SYS_get_mempolicy)
+    int m = preferred_node(p);
+    BOOST_TEST(m == -1 || m == n);
+#endif
+    a.deallocate(p, 1 << 16);
+}
+
+void test_access()
+{
+    boost::numa_allocator<int> a(0);
+    int* p = boost::allocator_allocate(a, 3);
+    boost::allocator_construct(a, p, 5);
+    BOOST_TEST_EQ(*p, 5);
+    boost::allocator_destroy(a, p);
+    boost::allocator_deallocate(a, p, 3);
+    BOOST_TEST_EQ(boost::allocator_max_size(a), a.max_size());
+    boost::allocator_rebind<boost::numa_allocator<int>, char>::type c(a);
+    BOOST_TEST_EQ(c.node(), 0);
+    BOOST_TEST(c == a);
+    BOOST_TEST(!(c != boost::numa_allocator<int>(1)));
+    BOOST_TEST(!boost::allocator_propagate_on_container_copy_assignment<
+        boost::numa_allocator<int> >::type::value);
+}
+
+void test_containers()
+{
+    std::vector<int, boost::numa_allocator<int> >
+        v((boost::numa_allocator<int>(0)));
+    for (int i = 0; i < 100000; ++i) {
+        v.push_back(i);
+    }
+    BOOST_TEST_EQ(v[99999], 99999);
+    BOOST_TEST_EQ(v.get_allocator().node(), 0);
+    std::list<int, boost::numa_allocator<int> > l;
+    for (int i = 0; i < 100; ++i) {
+        l.push_back(i);
+    }
+    BOOST_TEST_EQ(l.back(), 99);
+}
+
+int main()
+{
+    test_allocate();
+    test_node();
+    test_access();
+    test_containers();
+    return boost::report_errors();
+}
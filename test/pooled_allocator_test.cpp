@@ -0,0 +1,219 @@
+/*
+Copyright 2026
+
+Distributed under the Boost Software License, Version 1.0.
+(http://www.boost.org/LICENSE_1_0.txt)
+*/
+#include <boost/core/pooled_allocator.hpp>
+#include <boost/core/allocator_access.hpp>
+#include <boost/core/noinit_adaptor.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <list>
+#include <map>
+#if defined(BOOST_CORE_POOLED_ALLOCATOR_CACHE)
+#include <thread>
+#include <unordered_map>
+#endif
+
+struct S {
+    explicit S(int v)
+        : v(v) { }
+
+    double d[5];
+    int v;
+};
+
+void test_allocate()
+{
+    boost::pooled_allocator<S> a;
+    for (std::size_t n = 0; n < 20; ++n) {
+        S* p = a.allocate(n);
+        BOOST_TEST(p != 0);
+        for (std::size_t i = 0; i < n; ++i) {
+            ::new(static_cast<void*>(p + i)) S(static_cast<int>(i));
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            BOOST_TEST_EQ(p[i].v, static_cast<int>(i));
+        }
+        a.deallocate(p, n);
+    }
+    std::vector<int*> v;
+    boost::pooled_allocator<int> b;
+    for (int i = 0; i < 5000; ++i) {
+        int* p = b.allocate(1);
+        *p = i;
+        v.push_back(p);
+    }
+    for (int i = 0; i < 5000; ++i) {
+        BOOST_TEST_EQ(*v[i], i);
+    }
+    for (int i = 0; i < 5000; ++i) {
+        b.deallocate(v[i], 1);
+    }
+#if defined(BOOST_CORE_POOLED_ALLOCATOR_CACHE)
+    int* p = b.allocate(1);
+    b.deallocate(p, 1);
+    BOOST_TEST(b.allocate(1) == p);
+    b.deallocate(p, 1);
+#endif
+}
+
+void test_allocate_at_least()
+{
+    boost::pooled_allocator<S> a;
+    for (std::size_t n = 0; n < 20; ++n) {
+        boost::allocation_result<S*> r = a.allocate_at_least(n);
+        BOOST_TEST(r.ptr != 0);
+        BOOST_TEST_GE(r.count, n);
+        for (std::size_t i = 0; i < r.count; ++i) {
+            ::new(static_cast<void*>(r.ptr + i)) S(static_cast<int>(i));
+        }
+        a.deallocate(r.ptr, r.count);
+    }
+#if defined(BOOST_CORE_POOLED_ALLOCATOR_CACHE)
+    boost::pooled_allocator<char> c;
+    boost::allocation_result<char*> r = c.allocate_at_least(17);
+    BOOST_TEST_EQ(r.count, 32);
+    c.deallocate(r.ptr, r.count);
+    r = boost::allocator_allocate_at_least(c, 100);
+    BOOST_TEST_EQ(r.count, 112);
+    c.deallocate(r.ptr, r.count);
+#endif
+}
+
+#if !defined(BOOST_NO_CXX11_ALIGNAS)
+struct alignas(64) V {
+    char c[16];
+};
+#endif
+
+void test_alignment()
+{
+#if defined(BOOST_CORE_POOLED_ALLOCATOR_CACHE)
+    boost::pooled_allocator<char> c;
+    boost::allocation_result<char*> r = c.allocate_at_least(1);
+    BOOST_TEST_EQ(r.count, 16);
+    c.deallocate(r.ptr, r.count);
+#endif
+#if !defined(BOOST_NO_CXX11_ALIGNAS)
+    boost::pooled_allocator<V> a;
+    boost::allocation_result<V*> v = a.allocate_at_least(1);
+    BOOST_TEST_EQ(v.count, 1);
+    a.deallocate(v.ptr, v.count);
+#endif
+}
+
+void test_access()
+{
+    boost::pooled_allocator<int> a;
+    int* p = boost::allocator_allocate(a, 3);
+    boost::allocator_construct(a, p, 5);
+    BOOST_TEST_EQ(*p, 5);
+    boost::allocator_destroy(a, p);
+    boost::allocator_deallocate(a, p, 3);
+    boost::allocator_rebind<boost::pooled_allocator<int>, S>::type s(a);
+    BOOST_TEST(s == a);
+    BOOST_TEST(!(s != a));
+    BOOST_TEST(boost::allocator_is_always_equal<
+        boost::pooled_allocator<int> >::type::value);
+}
+
+void test_noinit()
+{
+    std::vector<int, boost::noinit_adaptor<boost::pooled_allocator<int> > >
+        v(3);
+    v[0] = 1;
+    v.resize(1000, 2);
+    BOOST_TEST_EQ(v[0], 1);
+    BOOST_TEST_EQ(v[999], 2);
+}
+
+void test_containers()
+{
+    std::list<S, boost::pooled_allocator<S> > l;
+    std::map<int, int, std::less<int>,
+        boost::pooled_allocator<std::pair<const int, int> > > m;
+    for (int i = 0; i < 1000; ++i) {
+        l.push_back(S(i));
+        m[i] = i * 2;
+    }
+    BOOST_TEST_EQ(l.back().v, 999);
+    BOOST_TEST_EQ(m[500], 1000);
+#if defined(BOOST_CORE_POOLED_ALLOCATOR_CACHE)
+    std::unordered_map<int, int, std::hash<int>, std::equal_to<int>,
+        boost::pooled_allocator<std::pair<const int, int> > > u;
+    for (int i = 0; i < 1000; ++i) {
+        u[i] = i;
+    }
+    BOOST_TEST_EQ(u[700], 700);
+#endif
+}
+
+#if defined(BOOST_CORE_POOLED_ALLOCATOR_CACHE)
+struct pair_list {
+    std::list<std::pair<int, int>,
+        boost::pooled_allocator<std::pair<int, int> > > list;
+};
+
+/* blocks are allocated by one thread and freed by another */
+void test_threads()
+{
+    const int n = 4;
+    const int m = 20000;
+    std::vector<pair_list> lists(n);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < n; ++t) {
+        threads.push_back(std::thread([&lists, t] {
+            for (int i = 0; i < m; ++i) {
+                lists[t].list.push_back(std::make_pair(t, i));
+            }
+        }));
+    }
+    for (int t = 0; t < n; ++t) {
+        threads[t].join();
+    }
+    threads.clear();
+    for (int t = 0; t < n; ++t) {
+        int i = 0;
+        for (std::list<std::pair<int, int>, boost::pooled_allocator<std::pair<
+            int, int> > >::iterator j = lists[t].list.begin();
+            j != lists[t].list.end(); ++j, ++i) {
+            BOOST_TEST(j->first == t && j->second == i);
+        }
+        BOOST_TEST_EQ(i, m);
+    }
+    for (int t = 0; t < n; ++t) {
+        threads.push_back(std::thread([&lists, t] {
+            lists[(t + 1) % n].list.clear();
+            std::vector<int*> v;
+            boost::pooled_allocator<int> a;
+            for (int i = 0; i < m; ++i) {
+                v.push_back(a.allocate(1));
+                *v.back() = t;
+            }
+            for (int i = 0; i < m; ++i) {
+                BOOST_TEST_EQ(*v[i], t);
+                a.deallocate(v[i], 1);
+            }
+        }));
+    }
+    for (int t = 0; t < n; ++t) {
+        threads[t].join();
+    }
+}
+#endif
+
+int main()
+{
+    test_allocate();
+    test_allocate_at_least();
+    test_alignment();
+    test_access();
+    test_noinit();
+    test_containers();
+#if defined(BOOST_CORE_POOLED_ALLOCATOR_CACHE)
+    test_threads();
+#endif
+    return boost::report_errors();
+}
@@ -0,0 +1,285 @@
+/*
+Copyright 2026
+
+Distributed under the Boost Software License, Version 1.0.
+(http://www.boost.org/LICENSE_1_0.txt)
+*/
+#include <boost/config.hpp>
+#if !defined(BOOST_NO_CXX11_THREAD_LOCAL) && \
+    !defined(BOOST_NO_CXX11_HDR_ATOMIC) && \
+    !defined(BOOST_NO_CXX11_HDR_MUTEX) && \
+    !defined(BOOST_NO_CXX11_HDR_CHRONO) && \
+    !defined(BOOST_NO_CXX11_HDR_THREAD)
+#include <boost/core/stats_adaptor.hpp>
+#include <boost/core/default_allocator.hpp>
+#include <boost/core/lightweight_test_trait.hpp>
+#include <cstring>
+#include <list>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+struct tag1 { };
+struct tag2 { };
+struct tag3 { };
+struct tag4 { };
+struct tag5 { };
+struct tag6 { };
+struct tag7 { };
+struct tag8 { };
+
+template<class T>
+struct expandable
+    : boost::default_allocator<T> {
+    template<class U>
+    struct rebind {
+        typedef expandable<U> other;
+    };
+
+    expandable() { }
+
+    template<class U>
+    expandable(const expandable<U>&) { }
+
+    bool expand(T*, std::size_t n, std::size_t m) {
+        return m >= n;
+    }
+};
+
+void test_counts()
+{
+    boost::stats_adaptor<boost::default_allocator<int>, tag1> a;
+    int* p = a.allocate(3);
+    boost::allocator_stats s = boost::stats_snapshot<tag1>();
+    BOOST_TEST_EQ(s.allocations, 1);
+    BOOST_TEST_EQ(s.deallocations, 0);
+    BOOST_TEST_EQ(s.bytes_allocated, 3 * sizeof(int));
+    BOOST_TEST_EQ(s.bytes(), 3 * sizeof(int));
+    BOOST_TEST_EQ(s.sizes[boost::core::bit_width(3 * sizeof(int))], 1);
+    a.deallocate(p, 3);
+    p = boost::allocator_allocate(a, 5, 0);
+    boost::allocator_deallocate(a, p, 5);
+    s = boost::stats_snapshot<tag1>();
+    BOOST_TEST_EQ(s.allocations, 2);
+    BOOST_TEST_EQ(s.deallocations, 2);
+    BOOST_TEST_EQ(s.bytes_allocated, 8 * sizeof(int));
+    BOOST_TEST_EQ(s.bytes_deallocated, 8 * sizeof(int));
+    BOOST_TEST_EQ(s.bytes(), 0);
+    BOOST_TEST_EQ(boost::stats_snapshot<tag2>().allocations, 0);
+}
+
+void test_allocate_at_least()
+{
+    boost::stats_adaptor<boost::default_allocator<char>, tag2> a;
+    boost::allocation_result<char*> r =
+        boost::allocator_allocate_at_least(a, 10);
+    BOOST_TEST_GE(r.count, 10);
+    BOOST_TEST_EQ(boost::stats_snapshot<tag2>().bytes(), r.count);
+    a.deallocate(r.ptr, r.count);
+    BOOST_TEST_EQ(boost::stats_snapshot<tag2>().bytes(), 0);
+}
+
+template<class T>
+struct reallocating {
+    typedef T value_type;
+
+    reallocating() { }
+
+    template<class U>
+    reallocating(const reallocating<U>&) { }
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(::operator new(sizeof(T) * n));
+    }
+
+    void deallocate(T* p, std::size_t) {
+        ::operator delete(p);
+    }
+
+    T* reallocate(T* p, std::size_t n, std::size_t m) {
+        T* q = allocate(m);
+        std::memcpy(q, p, sizeof(T) * (n < m ? n : m));
+        deallocate(p, n);
+        return q;
+    }
+};
+
+template<class T, class U>
+bool
+operator==(const reallocating<T>&, const reallocating<U>&)
+{
+    return true;
+}
+
+template<class T, class U>
+bool
+operator!=(const reallocating<T>&, const reallocating<U>&)
+{
+    return false;
+}
+
+void test_reallocate()
+{
+    boost::stats_adaptor<reallocating<int>, tag8> a;
+    int* p = a.allocate(10);
+    p[9] = 9;
+    p = boost::allocator_reallocate(a, p, 10, 100000, 10);
+    BOOST_TEST_EQ(p[9], 9);
+    boost::allocator_stats s = boost::stats_snapshot<tag8>();
+    BOOST_TEST_EQ(s.allocations, 1);
+    BOOST_TEST_EQ(s.bytes_allocated, 100000 * sizeof(int));
+    BOOST_TEST_EQ(s.bytes(), 100000 * sizeof(int));
+    BOOST_TEST_GE(s.peak_bytes, 100000 * sizeof(int));
+    p = boost::allocator_reallocate(a, p, 100000, 20, 10);
+    BOOST_TEST_EQ(boost::stats_snapshot<tag8>().bytes(), 20 * sizeof(int));
+    a.deallocate(p, 20);
+    s = boost::stats_snapshot<tag8>();
+    BOOST_TEST_EQ(s.deallocations, 1);
+    BOOST_TEST_EQ(s.bytes(), 0);
+    BOOST_TEST_EQ(s.bytes_allocated, s.bytes_deallocated);
+    boost::stats_adaptor<std::allocator<int>, tag8> b;
+    p = b.allocate(4);
+    p = boost::allocator_reallocate(b, p, 4, 8, 4);
+    b.deallocate(p, 8);
+    BOOST_TEST_EQ(boost::stats_snapshot<tag8>().bytes(), 0);
+}
+
+void test_expand()
+{
+    boost::stats_adaptor<expandable<int>, tag7> a;
+    int* p = a.allocate(100);
+    BOOST_TEST(boost::allocator_expand(a, p, 100, 104));
+    boost::allocator_stats s = boost::stats_snapshot<tag7>();
+    BOOST_TEST_EQ(s.allocations, 1);
+    BOOST_TEST_EQ(s.bytes_allocated, 104 * sizeof(int));
+    BOOST_TEST_EQ(s.bytes(), 104 * sizeof(int));
+    BOOST_TEST(!boost::allocator_expand(a, p, 104, 50));
+    BOOST_TEST(boost::allocator_expand(a, p, 104, 1 << 20));
+    BOOST_TEST_GE(boost::stats_snapshot<tag7>().peak_bytes,
+        (1 << 20) * sizeof(int));
+    a.deallocate(p, 1 << 20);
+    s = boost::stats_snapshot<tag7>();
+    BOOST_TEST_EQ(s.bytes(), 0);
+    BOOST_TEST_EQ(s.bytes_deallocated, (1 << 20) * sizeof(int));
+    boost::stats_adaptor<boost::default_allocator<char>, tag7> b;
+    char* q = b.allocate(100);
+    std::size_t m = 100;
+    if (boost::allocator_expand(b, q, 100, 104)) {
+        m = 104;
+    }
+    b.deallocate(q, m);
+    BOOST_TEST_EQ(boost::stats_snapshot<tag7>().bytes(), 0);
+}
+
+void test_peak()
+{
+    boost::stats_adaptor<std::allocator<char>, tag3> a;
+    char* p = a.allocate(1 << 20);
+    a.deallocate(p, 1 << 20);
+    p = a.allocate(1);
+    boost::allocator_stats s = boost::stats_snapshot<tag3>();
+    BOOST_TEST_EQ(s.bytes(), 1);
+    BOOST_TEST_GE(s.peak_bytes, 1 << 20);
+    a.deallocate(p, 1);
+}
+
+void test_rebind()
+{
+    typedef boost::stats_adaptor<std::allocator<int>, tag4> A;
+    BOOST_TEST_TRAIT_SAME(boost::allocator_rebind<A, char>::type,
+        boost::stats_adaptor<std::allocator<char>, tag4>);
+    std::list<int, A> l;
+    for (int i = 0; i < 100; ++i) {
+        l.push_back(i);
+    }
+    boost::allocator_stats s = boost::stats_snapshot<tag4>();
+    BOOST_TEST_GE(s.allocations, 100);
+    BOOST_TEST_GE(s.bytes(), 100 * sizeof(int));
+    l.clear();
+    std::map<int, int, std::less<int>, boost::stats_adaptor<std::allocator<
+        std::pair<const int, int> >, tag4> > m;
+    m[1] = 2;
+    m.clear();
+    s = boost::stats_snapshot<tag4>();
+    BOOST_TEST_EQ(s.allocations, s.deallocations);
+    BOOST_TEST_EQ(s.bytes(), 0);
+    boost::allocator_rebind<A, char>::type c(A{});
+    BOOST_TEST(c == A());
+    BOOST_TEST(!(c != A()));
+    BOOST_TEST(boost::stats_adapt(std::allocator<int>()) ==
+        boost::stats_adaptor<std::allocator<int> >());
+}
+
+void test_lifetimes()
+{
+    boost::stats_adaptor<std::allocator<int>, tag5> a;
+    std::vector<int*> v;
+    for (int i = 0; i < 4096; ++i) {
+        v.push_back(a.allocate(1));
+    }
+    for (int i = 0; i < 4096; ++i) {
+        a.deallocate(v[i], 1);
+    }
+    boost::allocator_stats s = boost::stats_snapshot<tag5>();
+    boost::uint64_t n = 0;
+    for (std::size_t i = 0; i < boost::allocator_stats::buckets; ++i) {
+        n += s.lifetimes[i];
+    }
+    BOOST_TEST_GT(n, 0);
+    BOOST_TEST_LT(n, 4096);
+    std::ostringstream os;
+    os << s;
+    BOOST_TEST(os.str().find("allocations: 4096\n") != std::string::npos);
+    BOOST_TEST(os.str().find("  [4, 8): 4096\n") != std::string::npos);
+}
+
+void test_threads()
+{
+    typedef boost::stats_adaptor<std::allocator<int>, tag6> A;
+    const int n = 4;
+    const int m = 10000;
+    std::vector<std::vector<int, A> > vectors(n);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < n; ++t) {
+        threads.push_back(std::thread([&vectors, t] {
+            std::list<int, A> l;
+            for (int i = 0; i < m; ++i) {
+                l.push_back(i);
+                vectors[t].push_back(i);
+            }
+            boost::stats_snapshot<tag6>();
+        }));
+    }
+    for (int t = 0; t < n; ++t) {
+        threads[t].join();
+    }
+    boost::allocator_stats s = boost::stats_snapshot<tag6>();
+    BOOST_TEST_GE(s.allocations, n * m);
+    BOOST_TEST_EQ(s.bytes(), n * vectors[0].capacity() * sizeof(int));
+    BOOST_TEST_GE(s.peak_bytes, s.bytes());
+    vectors.clear();
+    s = boost::stats_snapshot<tag6>();
+    BOOST_TEST_EQ(s.allocations, s.deallocations);
+    BOOST_TEST_EQ(s.bytes(), 0);
+}
+
+int main()
+{
+    test_counts();
+    test_allocate_at_least();
+    test_expand();
+    test_reallocate();
+    test_peak();
+    test_rebind();
+    test_lifetimes();
+    test_threads();
+    return boost::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
@@ -0,0 +1,110 @@
+// Test for boost/core/string_hash.hpp in constant expressions
+//
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/string_hash.hpp>
+#include <boost/config.hpp>
+#include <boost/config/pragma_message.hpp>
+
+#if defined(BOOST_NO_CXX14_CONSTEXPR)
+
+BOOST_PRAGMA_MESSAGE( "Test skipped because BOOST_NO_CXX14_CONSTEXPR is defined" )
+int main() {}
+
+#else
+
+#include <boost/core/lightweight_test.hpp>
+#include <boost/cstdint.hpp>
+#include <string>
+#include <cstddef>
+
+#define U64(h, l) ( ( boost::uint64_t( h##u ) << 32 ) + l##u )
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+using boost::core::string_hash;
+using boost::core::string_view;
+
+// the known values from string_hash_test.cpp, computed at compile time
+
+STATIC_ASSERT( string_hash( string_view( "", 0 ) ) == U64( 0x93228a4d, 0xe0eec5a2 ) );
+STATIC_ASSERT( string_hash( string_view( "a", 1 ) ) == U64( 0xaced1252, 0x7fe5bff8 ) );
+STATIC_ASSERT( string_hash( string_view( "abc", 3 ) ) == U64( 0x989b4a20, 0x9c1011c9 ) );
+STATIC_ASSERT( string_hash( string_view( "message digest", 14 ) ) == U64( 0x309ab4c0, 0x45215e8f ) );
+STATIC_ASSERT( string_hash( string_view( "abcdefghijklmnopqrstuvwxyz", 26 ) ) == U64( 0xccaeadc1, 0x2a061176 ) );
+STATIC_ASSERT( string_hash( string_view( "12345678901234567890123456789012345678901234567890123456789012345678901234567890", 80 ) ) == U64( 0x7e22da19, 0xf1a6055a ) );
+STATIC_ASSERT( string_hash( string_view( "abc", 3 ), 12345 ) == U64( 0x65124d74, 0x2a0d371b ) );
+
+STATIC_ASSERT( boost::core::string_view_hash()( string_view( "abc", 3 ) ) == static_cast<std::size_t>( U64( 0x989b4a20, 0x9c1011c9 ) ) );
+
+#if defined(BOOST_CORE_HAS_BUILTIN_IS_CONSTANT_EVALUATED) || ( defined(__cpp_lib_constexpr_char_traits) && __cpp_lib_constexpr_char_traits >= 201611L )
+# define BOOST_CORE_TEST_SV_LITERAL
+#endif
+
+#if defined(BOOST_CORE_TEST_SV_LITERAL)
+
+STATIC_ASSERT( string_hash( "message digest" ) == U64( 0x309ab4c0, 0x45215e8f ) );
+
+#endif
+
+// every length up to and past the three lane loop, compared to runtime
+
+char const text[] = "The quick brown fox jumps over the lazy dog, then over the lazy cat, then over the lazy fox again.";
+
+template<std::size_t N> struct cx_hashes
+{
+    boost::uint64_t h[ N ];
+
+    constexpr cx_hashes(): h()
+    {
+        for( std::size_t i = 0; i < N; ++i )
+        {
+            h[ i ] = string_hash( string_view( text, i ), i );
+        }
+    }
+};
+
+constexpr std::size_t N = sizeof( text ) - 1;
+constexpr cx_hashes<N + 1> hashes;
+
+static int method( string_view sv )
+{
+    switch( string_hash( sv ) )
+    {
+#if defined(BOOST_CORE_TEST_SV_LITERAL)
+
+    case string_hash( "GET" ): return 1;
+    case string_hash( "PUT" ): return 2;
+    case string_hash( "POST" ): return 3;
+
+#else
+
+    case string_hash( string_view( "GET", 3 ) ): return 1;
+    case string_hash( string_view( "PUT", 3 ) ): return 2;
+    case string_hash( string_view( "POST", 4 ) ): return 3;
+
+#endif
+
+    default: return 0;
+    }
+}
+
+int main()
+{
+    for( std::size_t i = 0; i <= N; ++i )
+    {
+        std::string s( text, i );
+        BOOST_TEST_EQ( hashes.h[ i ], string_hash( s, i ) );
+    }
+
+    BOOST_TEST_EQ( method( "GET" ), 1 );
+    BOOST_TEST_EQ( method( std::string( "PUT" ) ), 2 );
+    BOOST_TEST_EQ( method( "POST" ), 3 );
+    BOOST_TEST_EQ( method( "DELETE" ), 0 );
+
+    return boost::report_errors();
+}
+
+#endif
@@ -0,0 +1,170 @@
+// Test for boost/core/string_hash.hpp
+//
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/string_hash.hpp>
+#include <boost/core/bit.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/cstdint.hpp>
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <cstddef>
+#if !defined(BOOST_NO_CXX11_HDR_UNORDERED_SET)
+# include <unordered_set>
+#endif
+
+#define U64(h, l) ( ( boost::uint64_t( h##u ) << 32 ) + l##u )
+
+static std::string random_string( boost::detail::splitmix64& rng, std::size_t n )
+{
+    std::string r;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        r += static_cast<char>( rng() & 0xFF );
+    }
+
+    return r;
+}
+
+int main()
+{
+    using boost::core::string_hash;
+
+    // known values; they must not depend on the platform
+
+    BOOST_TEST_EQ( string_hash( "" ), U64( 0x93228a4d, 0xe0eec5a2 ) );
+    BOOST_TEST_EQ( string_hash( "a" ), U64( 0xaced1252, 0x7fe5bff8 ) );
+    BOOST_TEST_EQ( string_hash( "abc" ), U64( 0x989b4a20, 0x9c1011c9 ) );
+    BOOST_TEST_EQ( string_hash( "message digest" ), U64( 0x309ab4c0, 0x45215e8f ) );
+    BOOST_TEST_EQ( string_hash( "abcdefghijklmnopqrstuvwxyz" ), U64( 0xccaeadc1, 0x2a061176 ) );
+    BOOST_TEST_EQ( string_hash( "12345678901234567890123456789012345678901234567890123456789012345678901234567890" ), U64( 0x7e22da19, 0xf1a6055a ) );
+    BOOST_TEST_EQ( string_hash( "abc", 12345 ), U64( 0x65124d74, 0x2a0d371b ) );
+
+    boost::detail::splitmix64 rng;
+
+    // the hash depends on the contents, not on the address
+
+    for( std::size_t n = 0; n < 200; ++n )
+    {
+        std::string s = random_string( rng, n );
+        std::string t( s );
+
+        BOOST_TEST_EQ( string_hash( s ), string_hash( t ) );
+        BOOST_TEST_EQ( boost::core::string_view_hash()( s ), static_cast<std::size_t>( string_hash( t ) ) );
+    }
+
+    // no collisions among random strings of all lengths,
+    // and among strings that differ in a single byte
+
+    {
+        std::vector<boost::uint64_t> v;
+
+        for( int i = 0; i < 20000; ++i )
+        {
+            v.push_back( string_hash( random_string( rng, 8 + static_cast<std::size_t>( rng() % 120 ) ) ) );
+        }
+
+        std::string s( 100, 'x' );
+
+        for( std::size_t i = 0; i < s.size(); ++i )
+        {
+            for( int j = 0; j < 256; ++j )
+            {
+                if( j == 'x' ) continue;
+
+                std::string t( s );
+                t[ i ] = static_cast<char>( j );
+
+                v.push_back( string_hash( t ) );
+            }
+        }
+
+        for( std::size_t n = 0; n <= s.size(); ++n )
+        {
+            v.push_back( string_hash( boost::core::string_view( s ).substr( 0, n ) ) );
+        }
+
+        std::sort( v.begin(), v.end() );
+        BOOST_TEST( std::adjacent_find( v.begin(), v.end() ) == v.end() );
+    }
+
+    // avalanche: flipping any input bit flips each output bit
+    // with a probability close to 1/2
+
+    {
+        std::size_t const lengths[] = { 1, 3, 4, 7, 8, 15, 16, 17, 33, 48, 49, 100 };
+
+        for( std::size_t k = 0; k < sizeof( lengths ) / sizeof( lengths[ 0 ] ); ++k )
+        {
+            std::size_t const n = lengths[ k ];
+
+            int const trials = 200;
+
+            int counts[ 64 ] = {};
+            int total = 0;
+
+            for( int i = 0; i < trials; ++i )
+            {
+                std::string s = random_string( rng, n );
+
+                boost::uint64_t const h = string_hash( s );
+
+                for( std::size_t j = 0; j < n * 8; ++j )
+                {
+                    std::string t( s );
+                    t[ j / 8 ] = static_cast<char>( t[ j / 8 ] ^ ( 1 << ( j % 8 ) ) );
+
+                    boost::uint64_t const d = h ^ string_hash( t );
+
+                    for( int b = 0; b < 64; ++b )
+                    {
+                        counts[ b ] += static_cast<int>( ( d >> b ) & 1 );
+                    }
+
+                    total += boost::core::popcount( d );
+                }
+            }
+
+            int const m = trials * static_cast<int>( n ) * 8;
+
+            BOOST_TEST_GT( total, m * 30 );
+            BOOST_TEST_LT( total, m * 34 );
+
+            for( int b = 0; b < 64; ++b )
+            {
+                BOOST_TEST_GT( counts[ b ] * 10, m * 4 );
+                BOOST_TEST_LT( counts[ b ] * 10, m * 6 );
+            }
+        }
+    }
+
+    // the seed changes the result
+
+    {
+        std::string s = random_string( rng, 10 );
+        BOOST_TEST_NE( string_hash( s, 1 ), string_hash( s, 2 ) );
+    }
+
+#if !defined(BOOST_NO_CXX11_HDR_UNORDERED_SET)
+
+    {
+        std::unordered_set<std::string, boost::core::string_view_hash> st;
+
+        st.insert( "one" );
+        st.insert( "two" );
+        st.insert( "one" );
+
+        BOOST_TEST_EQ( st.size(), 2 );
+        BOOST_TEST_EQ( st.count( "two" ), 1 );
+        BOOST_TEST_EQ( st.count( "three" ), 0 );
+    }
+
+#endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,180 @@
+// Test for boost/core/string_icase.hpp
+//
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/string_icase.hpp>
+#include <boost/core/string_hash.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <cstddef>
+#if !defined(BOOST_NO_CXX11_HDR_UNORDERED_SET)
+# include <unordered_set>
+#endif
+
+using boost::core::string_view;
+
+static char lower( char c )
+{
+    return c >= 'A' && c <= 'Z'? static_cast<char>( c - 'A' + 'a' ): c;
+}
+
+static std::string to_lower( std::string s )
+{
+    for( std::size_t i = 0; i < s.size(); ++i )
+    {
+        s[ i ] = lower( s[ i ] );
+    }
+
+    return s;
+}
+
+static std::size_t ref_ifind( std::string const& s, std::string const& t, std::size_t pos )
+{
+    return to_lower( s ).find( to_lower( t ), pos );
+}
+
+// letters in both cases, the characters next to 'A', 'Z', 'a' and 'z',
+// and bytes with the high bit set whose low 7 bits are letters
+
+static char const alphabet[] = { 'a', 'A', 'b', 'B', 'z', 'Z', '@', '[', '`', '{', '0', static_cast<char>( 0xC1 ), static_cast<char>( 0xE1 ) };
+
+static std::string random_string( boost::detail::splitmix64& rng, std::size_t n, std::size_t k )
+{
+    std::string r;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        r += alphabet[ rng() % k ];
+    }
+
+    return r;
+}
+
+static std::string random_case( boost::detail::splitmix64& rng, std::string s )
+{
+    for( std::size_t i = 0; i < s.size(); ++i )
+    {
+        if( s[ i ] >= 'a' && s[ i ] <= 'z' && ( rng() & 1 ) )
+        {
+            s[ i ] = static_cast<char>( s[ i ] - 'a' + 'A' );
+        }
+    }
+
+    return s;
+}
+
+int main()
+{
+    using namespace boost::core;
+
+    BOOST_TEST( iequals( "", "" ) );
+    BOOST_TEST( iequals( "Content-Length", "content-length" ) );
+    BOOST_TEST( iequals( "SELECT", "select" ) );
+    BOOST_TEST( !iequals( "select", "selec" ) );
+    BOOST_TEST( !iequals( "@", "`" ) );
+    BOOST_TEST( !iequals( "[", "{" ) );
+    BOOST_TEST( !iequals( "\xC1", "\xE1" ) );
+    BOOST_TEST( iequals( std::string( "Transfer-Encoding: CHUNKED" ), "transfer-encoding: chunked" ) );
+
+    BOOST_TEST( istarts_with( "Content-Type", "content-" ) );
+    BOOST_TEST( istarts_with( "abc", "" ) );
+    BOOST_TEST( !istarts_with( "ab", "abc" ) );
+    BOOST_TEST( iends_with( "index.HTML", ".html" ) );
+    BOOST_TEST( !iends_with( "ml", "html" ) );
+
+    BOOST_TEST_EQ( ifind( "SELECT * FROM t WHERE x", "from" ), 9u );
+    BOOST_TEST_EQ( ifind( "abc", "" ), 0u );
+    BOOST_TEST_EQ( ifind( "abc", "", 3 ), 3u );
+    BOOST_TEST_EQ( ifind( "abc", "", 4 ), string_view::npos );
+    BOOST_TEST_EQ( ifind( "abc", "C" ), 2u );
+    BOOST_TEST_EQ( ifind( "abc", "abcd" ), string_view::npos );
+    BOOST_TEST_EQ( ifind( "aXbxc", "X", 2 ), 3u );
+
+    BOOST_TEST_EQ( string_ihash( "Host" ), string_hash( "host" ) );
+    BOOST_TEST_EQ( string_ihash( "HOST", 7 ), string_hash( "host", 7 ) );
+    BOOST_TEST_NE( string_ihash( "@" ), string_ihash( "`" ) );
+    BOOST_TEST_EQ( string_view_ihash()( "Accept" ), string_view_ihash()( "ACCEPT" ) );
+    BOOST_TEST( string_view_iequal_to()( "Accept", "aCCEPT" ) );
+
+    boost::detail::splitmix64 rng;
+
+    // iequals, istarts_with, iends_with and string_ihash against the reference
+
+    for( int i = 0; i < 3000; ++i )
+    {
+        std::size_t const n = static_cast<std::size_t>( rng() % 100 );
+
+        std::string s1 = random_string( rng, n, sizeof( alphabet ) );
+        std::string s2 = random_case( rng, to_lower( s1 ) );
+
+        BOOST_TEST( iequals( s1, s2 ) );
+        BOOST_TEST_EQ( string_ihash( s1 ), string_hash( to_lower( s1 ) ) );
+        BOOST_TEST_EQ( string_ihash( s1 ), string_ihash( s2 ) );
+
+        if( n > 0 )
+        {
+            std::size_t const j = static_cast<std::size_t>( rng() % n );
+
+            std::string s3 = s2;
+            s3[ j ] = alphabet[ rng() % sizeof( alphabet ) ];
+
+            bool const r = lower( s3[ j ] ) == lower( s1[ j ] );
+
+            BOOST_TEST_EQ( iequals( s1, s3 ), r );
+            BOOST_TEST_EQ( istarts_with( s1, string_view( s3 ).substr( 0, j + 1 ) ), r );
+            BOOST_TEST_EQ( iends_with( s1, string_view( s3 ).substr( j ) ), r );
+            BOOST_TEST_EQ( string_ihash( s1 ) == string_ihash( s3 ), r );
+        }
+    }
+
+    // ifind against the reference, with a small alphabet so that
+    // partial matches are frequent
+
+    for( int i = 0; i < 3000; ++i )
+    {
+        std::size_t const n = static_cast<std::size_t>( rng() % 100 );
+        std::size_t const m = 1 + static_cast<std::size_t>( rng() % 6 );
+
+        std::string s = random_string( rng, n, 4 );
+        std::string t = random_string( rng, m, 4 );
+
+        std::size_t const pos = static_cast<std::size_t>( rng() % ( n + 2 ) );
+
+        BOOST_TEST_EQ( ifind( s, t, pos ), ref_ifind( s, t, pos ) );
+    }
+
+#if !defined(BOOST_NO_CXX11_HDR_UNORDERED_SET)
+
+    {
+        std::unordered_set<string_view, string_view_ihash, string_view_iequal_to> st;
+
+        st.insert( "Content-Length" );
+        st.insert( "CONTENT-LENGTH" );
+        st.insert( "Host" );
+
+        BOOST_TEST_EQ( st.size(), 2u );
+        BOOST_TEST_EQ( st.count( "content-length" ), 1u );
+        BOOST_TEST_EQ( st.count( "hOST" ), 1u );
+    }
+
+#endif
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+
+    {
+        constexpr bool r1 = iequals( string_view( "Host", 4 ), string_view( "HOST", 4 ) );
+        constexpr std::size_t r2 = ifind( string_view( "a-HOST", 6 ), string_view( "host", 4 ) );
+        constexpr boost::uint64_t r3 = string_ihash( string_view( "Host", 4 ) );
+
+        BOOST_TEST( r1 );
+        BOOST_TEST_EQ( r2, 2u );
+        BOOST_TEST_EQ( r3, string_hash( "host" ) );
+    }
+
+#endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,104 @@
+// Test for boost/core/string_searcher.hpp
+//
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/string_searcher.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <cstddef>
+
+static std::string random_string( boost::detail::splitmix64& rng, std::size_t n, int k )
+{
+    std::string r;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        r += static_cast<char>( 'a' + static_cast<int>( rng() % k ) );
+    }
+
+    return r;
+}
+
+int main()
+{
+    std::size_t const npos = boost::core::string_view::npos;
+
+    {
+        boost::core::horspool_searcher s( "" );
+        boost::core::reverse_horspool_searcher rs( "" );
+
+        BOOST_TEST_EQ( s.find( "" ), 0 );
+        BOOST_TEST_EQ( s.find( "", 1 ), npos );
+        BOOST_TEST_EQ( s.find( "123", 3 ), 3 );
+        BOOST_TEST_EQ( s.find( "123", 4 ), npos );
+
+        BOOST_TEST_EQ( rs.rfind( "" ), 0 );
+        BOOST_TEST_EQ( rs.rfind( "123" ), 3 );
+        BOOST_TEST_EQ( rs.rfind( "123", 1 ), 1 );
+    }
+
+    {
+        boost::core::horspool_searcher s( "123" );
+        boost::core::reverse_horspool_searcher rs( "123" );
+
+        BOOST_TEST_EQ( s.needle(), "123" );
+        BOOST_TEST_EQ( rs.needle(), "123" );
+
+        BOOST_TEST_EQ( s.find( "" ), npos );
+        BOOST_TEST_EQ( s.find( "12" ), npos );
+        BOOST_TEST_EQ( s.find( "123123" ), 0 );
+        BOOST_TEST_EQ( s.find( "123123", 1 ), 3 );
+        BOOST_TEST_EQ( s.find( "123123", 4 ), npos );
+
+        BOOST_TEST_EQ( rs.rfind( "" ), npos );
+        BOOST_TEST_EQ( rs.rfind( "12" ), npos );
+        BOOST_TEST_EQ( rs.rfind( "123123" ), 3 );
+        BOOST_TEST_EQ( rs.rfind( "123123", 2 ), 0 );
+        BOOST_TEST_EQ( rs.rfind( "0123123", 0 ), npos );
+    }
+
+    {
+        boost::core::basic_horspool_searcher<wchar_t> s( L"\x141\x241" );
+        boost::core::basic_reverse_horspool_searcher<wchar_t> rs( L"\x141\x241" );
+
+        BOOST_TEST_EQ( s.find( L"\x241\x141\x141\x241\x241" ), 2 );
+        BOOST_TEST_EQ( rs.rfind( L"\x141\x241\x141\x141\x241" ), 3 );
+        BOOST_TEST_EQ( s.find( L"\x141\x141\x241\x241" ), 1 );
+        BOOST_TEST_EQ( rs.rfind( L"\x141\x141\x241\x241" ), 1 );
+    }
+
+    boost::detail::splitmix64 rng;
+
+    for( int i = 0; i < 2000; ++i )
+    {
+        int k = 1 + static_cast<int>( rng() % 4 );
+
+        std::string h = random_string( rng, static_cast<std::size_t>( rng() % 300 ), k );
+        std::string s = random_string( rng, static_cast<std::size_t>( rng() % 70 ), k );
+
+        if( s.size() <= h.size() && rng() % 2 )
+        {
+            // take the needle from the haystack so that it is found
+            s = h.substr( static_cast<std::size_t>( rng() % ( h.size() - s.size() + 1 ) ), s.size() );
+        }
+
+        boost::core::horspool_searcher hs( s );
+        boost::core::reverse_horspool_searcher rhs( s );
+
+        for( int j = 0; j < 8; ++j )
+        {
+            std::size_t pos = static_cast<std::size_t>( rng() % ( h.size() + 2 ) );
+
+            BOOST_TEST_EQ( hs.find( h, pos ), h.find( s, pos ) );
+            BOOST_TEST_EQ( rhs.rfind( h, pos ), h.rfind( s, pos ) );
+        }
+
+        BOOST_TEST_EQ( hs.find( h ), h.find( s ) );
+        BOOST_TEST_EQ( rhs.rfind( h ), h.rfind( s ) );
+    }
+
+    return boost::report_errors();
+}
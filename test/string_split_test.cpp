@@ -0,0 +1,213 @@
+// Test for boost/core/string_split.hpp
+//
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/string_split.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <iterator>
+#include <vector>
+#include <string>
+#include <cstddef>
+
+typedef boost::core::string_view sv;
+
+template<class R> static std::vector<std::string> collect( R const& r )
+{
+    std::vector<std::string> v;
+
+    for( typename R::iterator it = r.begin(); it != r.end(); ++it )
+    {
+        v.push_back( std::string( it->data(), it->size() ) );
+    }
+
+    return v;
+}
+
+// reference implementations
+
+static std::vector<std::string> ref_split_string( std::string const& s, std::string const& d )
+{
+    std::vector<std::string> v;
+
+    if( d.empty() )
+    {
+        v.push_back( s );
+        return v;
+    }
+
+    std::size_t i = 0;
+
+    for( std::size_t j = 0; j + d.size() <= s.size(); )
+    {
+        if( s.compare( j, d.size(), d ) == 0 )
+        {
+            v.push_back( s.substr( i, j - i ) );
+            j += d.size();
+            i = j;
+        }
+        else
+        {
+            ++j;
+        }
+    }
+
+    v.push_back( s.substr( i ) );
+    return v;
+}
+
+static std::vector<std::string> ref_split_any( std::string const& s, std::string const& d )
+{
+    std::vector<std::string> v;
+
+    std::size_t i = 0;
+
+    for( std::size_t j = 0; j < s.size(); ++j )
+    {
+        if( d.find( s[ j ] ) != std::string::npos )
+        {
+            v.push_back( s.substr( i, j - i ) );
+            i = j + 1;
+        }
+    }
+
+    v.push_back( s.substr( i ) );
+    return v;
+}
+
+static std::vector<std::string> make( char const* a0 = 0, char const* a1 = 0, char const* a2 = 0, char const* a3 = 0 )
+{
+    std::vector<std::string> v;
+
+    if( a0 ) v.push_back( a0 );
+    if( a1 ) v.push_back( a1 );
+    if( a2 ) v.push_back( a2 );
+    if( a3 ) v.push_back( a3 );
+
+    return v;
+}
+
+int main()
+{
+    using boost::core::split;
+
+    // by char
+
+    BOOST_TEST( collect( split( "", ',' ) ) == make( "" ) );
+    BOOST_TEST( collect( split( ",", ',' ) ) == make( "", "" ) );
+    BOOST_TEST( collect( split( "abc", ',' ) ) == make( "abc" ) );
+    BOOST_TEST( collect( split( "a,b,,c", ',' ) ) == make( "a", "b", "", "c" ) );
+    BOOST_TEST( collect( split( ",a,", ',' ) ) == make( "", "a", "" ) );
+    BOOST_TEST( collect( split( std::string( "x;y" ), ';' ) ) == make( "x", "y" ) );
+
+    // by string
+
+    BOOST_TEST( collect( split( "", "::" ) ) == make( "" ) );
+    BOOST_TEST( collect( split( "a::b::c", "::" ) ) == make( "a", "b", "c" ) );
+    BOOST_TEST( collect( split( "a:::b", "::" ) ) == make( "a", ":b" ) );
+    BOOST_TEST( collect( split( "::", "::" ) ) == make( "", "" ) );
+    BOOST_TEST( collect( split( "abc", "" ) ) == make( "abc" ) );
+    BOOST_TEST( collect( split( "a\r\nb", sv( "\r\n" ) ) ) == make( "a", "b" ) );
+
+    // by char_set
+
+    boost::core::char_set const ws( " \t\n" );
+
+    BOOST_TEST( collect( split( "a b\tc\n", ws ) ) == make( "a", "b", "c", "" ) );
+    BOOST_TEST( collect( split( "  ", ws ) ) == make( "", "", "" ) );
+    BOOST_TEST( collect( split( "abc", boost::core::char_set() ) ) == make( "abc" ) );
+
+    // wide characters
+
+    {
+        wchar_t const s[] = L"a,bc";
+
+        boost::core::basic_split_range<wchar_t, wchar_t> r = split( boost::core::wstring_view( s ), L',' );
+        boost::core::basic_split_range<wchar_t, wchar_t>::iterator it = r.begin();
+
+        BOOST_TEST( *it == boost::core::wstring_view( L"a" ) );
+        ++it;
+        BOOST_TEST( *it == boost::core::wstring_view( L"bc" ) );
+        ++it;
+        BOOST_TEST( it == r.end() );
+    }
+
+    // the pieces refer to the input
+
+    {
+        char const* s = "ab,cd";
+
+        boost::core::basic_split_range<char, char> r = split( s, ',' );
+        boost::core::basic_split_range<char, char>::iterator it = r.begin();
+
+        BOOST_TEST_EQ( it->data(), s );
+        BOOST_TEST_EQ( (++it)->data(), s + 3 );
+    }
+
+    // forward iterator: multi-pass, copies advance independently
+
+    {
+        boost::core::basic_split_range<char, char> r = split( "a,b,c", ',' );
+
+        BOOST_TEST_EQ( std::distance( r.begin(), r.end() ), 3 );
+        BOOST_TEST_EQ( std::distance( r.begin(), r.end() ), 3 );
+
+        boost::core::basic_split_range<char, char>::iterator it1 = r.begin();
+        boost::core::basic_split_range<char, char>::iterator it2 = it1++;
+
+        BOOST_TEST( it1 != it2 );
+        BOOST_TEST( *it2 == sv( "a" ) );
+        BOOST_TEST( *it1 == sv( "b" ) );
+        BOOST_TEST( ++it2 == it1 );
+    }
+
+#if !defined(BOOST_NO_CXX11_RANGE_BASED_FOR) && !defined(BOOST_NO_CXX11_AUTO_DECLARATIONS)
+
+    {
+        std::vector<std::string> v;
+
+        for( auto piece: split( "1,22,333", ',' ) )
+        {
+            v.push_back( std::string( piece.data(), piece.size() ) );
+        }
+
+        BOOST_TEST( v == make( "1", "22", "333" ) );
+    }
+
+#endif
+
+    // random inputs against the reference
+
+    {
+        boost::detail::splitmix64 rng;
+
+        for( int i = 0; i < 2000; ++i )
+        {
+            std::size_t const n = static_cast<std::size_t>( rng() % 200 );
+
+            std::string s;
+
+            for( std::size_t j = 0; j < n; ++j )
+            {
+                s += static_cast<char>( 'a' + rng() % 4 );
+            }
+
+            std::size_t const m = 1 + static_cast<std::size_t>( rng() % 3 );
+
+            std::string d;
+
+            for( std::size_t j = 0; j < m; ++j )
+            {
+                d += static_cast<char>( 'a' + rng() % 4 );
+            }
+
+            BOOST_TEST( collect( split( s, d[ 0 ] ) ) == ref_split_string( s, d.substr( 0, 1 ) ) );
+            BOOST_TEST( collect( split( s, sv( d ) ) ) == ref_split_string( s, d ) );
+            BOOST_TEST( collect( split( s, boost::core::char_set( d.data(), d.size() ) ) ) == ref_split_any( s, d ) );
+        }
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,129 @@
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/detail/string_view.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <cstddef>
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+
+BOOST_CONSTEXPR_OR_CONST boost::core::char_set ws( " \t\r\n" );
+
+static_assert( ws.contains( ' ' ), "char_set::contains" );
+static_assert( ws.contains( '\n' ), "char_set::contains" );
+static_assert( !ws.contains( 'x' ), "char_set::contains" );
+static_assert( ws.size() == 4, "char_set::size" );
+
+#endif
+
+static std::string random_string( boost::detail::splitmix64& rng, std::size_t n, int first, int k )
+{
+    std::string r;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        r += static_cast<char>( static_cast<unsigned char>( first + static_cast<int>( rng() % k ) ) );
+    }
+
+    return r;
+}
+
+int main()
+{
+    std::size_t const npos = boost::core::string_view::npos;
+
+    {
+        boost::core::char_set cs;
+
+        BOOST_TEST( cs.empty() );
+        BOOST_TEST_EQ( cs.size(), 0 );
+        BOOST_TEST( !cs.contains( '\0' ) );
+
+        boost::core::string_view sv( "123" );
+
+        BOOST_TEST_EQ( sv.find_first_of( cs ), npos );
+        BOOST_TEST_EQ( sv.find_last_of( cs ), npos );
+        BOOST_TEST_EQ( sv.find_first_not_of( cs ), 0 );
+        BOOST_TEST_EQ( sv.find_last_not_of( cs ), 2 );
+    }
+
+    {
+        boost::core::char_set cs( "\xFF\x80", 2 );
+
+        BOOST_TEST( !cs.empty() );
+        BOOST_TEST_EQ( cs.size(), 2 );
+        BOOST_TEST( cs.contains( '\xFF' ) );
+        BOOST_TEST( cs.contains( '\x80' ) );
+        BOOST_TEST( cs.contains( L'\xFF' ) );
+        BOOST_TEST( !cs.contains( L'\x1FF' ) );
+        BOOST_TEST( !cs.contains( '\x7F' ) );
+    }
+
+    {
+        boost::core::char_set cs( "12" );
+
+        boost::core::string_view sv( "123123" );
+
+        BOOST_TEST_EQ( sv.find_first_of( cs ), 0 );
+        BOOST_TEST_EQ( sv.find_first_of( cs, 2 ), 3 );
+        BOOST_TEST_EQ( sv.find_first_of( cs, 5 ), npos );
+        BOOST_TEST_EQ( sv.find_first_of( cs, 7 ), npos );
+
+        BOOST_TEST_EQ( sv.find_last_of( cs ), 4 );
+        BOOST_TEST_EQ( sv.find_last_of( cs, 3 ), 3 );
+        BOOST_TEST_EQ( sv.find_last_of( cs, 2 ), 1 );
+
+        BOOST_TEST_EQ( sv.find_first_not_of( cs ), 2 );
+        BOOST_TEST_EQ( sv.find_first_not_of( cs, 3 ), 5 );
+        BOOST_TEST_EQ( sv.find_first_not_of( cs, 6 ), npos );
+
+        BOOST_TEST_EQ( sv.find_last_not_of( cs ), 5 );
+        BOOST_TEST_EQ( sv.find_last_not_of( cs, 4 ), 2 );
+        BOOST_TEST_EQ( sv.find_last_not_of( cs, 1 ), npos );
+    }
+
+    {
+        boost::core::char_set cs( "12" );
+
+        boost::core::wstring_view sv( L"123\x131" );
+
+        BOOST_TEST_EQ( sv.find_first_of( cs, 2 ), npos );
+        BOOST_TEST_EQ( sv.find_last_of( cs ), 1 );
+        BOOST_TEST_EQ( sv.find_first_not_of( cs ), 2 );
+        BOOST_TEST_EQ( sv.find_last_not_of( cs ), 3 );
+    }
+
+    boost::detail::splitmix64 rng;
+
+    for( int i = 0; i < 2000; ++i )
+    {
+        std::size_t n = static_cast<std::size_t>( rng() % 200 );
+
+        int first = static_cast<int>( rng() % 256 );
+        int k = 1 + static_cast<int>( rng() % ( 256 - first ) );
+
+        std::string h = random_string( rng, n, first, k );
+
+        for( int j = 0; j < 8; ++j )
+        {
+            std::string s = random_string( rng, static_cast<std::size_t>( rng() % 40 ), first, k );
+            std::size_t pos = static_cast<std::size_t>( rng() % ( n + 2 ) );
+
+            boost::core::char_set cs( s.data(), s.size() );
+            boost::core::string_view sv( h );
+
+            BOOST_TEST_EQ( sv.find_first_of( cs, pos ), h.find_first_of( s, pos ) );
+            BOOST_TEST_EQ( sv.find_last_of( cs, pos ), h.find_last_of( s, pos ) );
+            BOOST_TEST_EQ( sv.find_first_not_of( cs, pos ), h.find_first_not_of( s, pos ) );
+            BOOST_TEST_EQ( sv.find_last_not_of( cs, pos ), h.find_last_not_of( s, pos ) );
+
+            BOOST_TEST_EQ( sv.find_last_of( cs ), h.find_last_of( s ) );
+            BOOST_TEST_EQ( sv.find_last_not_of( cs ), h.find_last_not_of( s ) );
+        }
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,94 @@
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/detail/string_view.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <cstddef>
+
+// Exercises the long haystack paths of find_first_of and
+// find_first_not_of, including sets with non-ASCII characters
+// and sets too irregular for the nibble table classifier
+
+static std::size_t const npos = boost::core::string_view::npos;
+
+static std::size_t find_first_of_ref( std::string const& h, std::string const& s, std::size_t pos )
+{
+    for( std::size_t i = pos; i < h.size(); ++i )
+    {
+        if( s.find( h[ i ] ) != std::string::npos ) return i;
+    }
+
+    return npos;
+}
+
+static std::size_t find_first_not_of_ref( std::string const& h, std::string const& s, std::size_t pos )
+{
+    for( std::size_t i = pos; i < h.size(); ++i )
+    {
+        if( s.find( h[ i ] ) == std::string::npos ) return i;
+    }
+
+    return npos;
+}
+
+static std::string random_string( boost::detail::splitmix64& rng, std::size_t n, int first, int k )
+{
+    std::string r;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        r += static_cast<char>( static_cast<unsigned char>( first + static_cast<int>( rng() % k ) ) );
+    }
+
+    return r;
+}
+
+int main()
+{
+    boost::detail::splitmix64 rng;
+
+    for( int i = 0; i < 2000; ++i )
+    {
+        std::size_t n = static_cast<std::size_t>( rng() % 200 );
+
+        int first = static_cast<int>( rng() % 256 );
+        int k = 1 + static_cast<int>( rng() % ( 256 - first ) );
+
+        std::string h = random_string( rng, n, first, k );
+
+        for( int j = 0; j < 8; ++j )
+        {
+            std::size_t m = static_cast<std::size_t>( rng() % 40 );
+
+            std::string s = random_string( rng, m, first, k );
+            std::size_t pos = static_cast<std::size_t>( rng() % ( n + 2 ) );
+
+            boost::core::string_view sv( h );
+
+            BOOST_TEST_EQ( sv.find_first_of( s, pos ), find_first_of_ref( h, s, pos ) );
+            BOOST_TEST_EQ( sv.find_first_not_of( s, pos ), find_first_not_of_ref( h, s, pos ) );
+        }
+    }
+
+    {
+        std::string h( 1000, ' ' );
+
+        h[ 517 ] = '\t';
+        h[ 999 ] = '"';
+
+        boost::core::string_view sv( h );
+
+        BOOST_TEST_EQ( sv.find_first_of( "\t\r\n" ), 517 );
+        BOOST_TEST_EQ( sv.find_first_of( "\"'" ), 999 );
+        BOOST_TEST_EQ( sv.find_first_of( "\"'", 999 ), 999 );
+        BOOST_TEST_EQ( sv.find_first_of( ",;" ), npos );
+        BOOST_TEST_EQ( sv.find_first_not_of( " " ), 517 );
+        BOOST_TEST_EQ( sv.find_first_not_of( " \t" ), 999 );
+        BOOST_TEST_EQ( sv.find_first_not_of( " \t\"" ), npos );
+    }
+
+    return boost::report_errors();
+}
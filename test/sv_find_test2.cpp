@@ -0,0 +1,102 @@
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/detail/string_view.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <cstddef>
+
+// Exercises the long haystack paths of find, which
+// the short strings in sv_find_test.cpp do not reach
+
+static std::size_t find_ref( std::string const& h, std::string const& s, std::size_t pos )
+{
+    if( pos > h.size() || s.size() > h.size() - pos ) return boost::core::string_view::npos;
+
+    for( std::size_t i = pos; i + s.size() <= h.size(); ++i )
+    {
+        if( h.compare( i, s.size(), s ) == 0 ) return i;
+    }
+
+    return boost::core::string_view::npos;
+}
+
+static std::string random_string( boost::detail::splitmix64& rng, std::size_t n, char first, int k )
+{
+    std::string r;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        r += static_cast<char>( first + static_cast<int>( rng() % k ) );
+    }
+
+    return r;
+}
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR) && defined(__cpp_lib_constexpr_char_traits) && __cpp_lib_constexpr_char_traits >= 201611L
+
+constexpr std::size_t cfind( boost::core::string_view sv, boost::core::string_view s )
+{
+    return sv.find( s );
+}
+
+static_assert( cfind( "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxabcxx", "abc" ) == 51, "constexpr find" );
+
+#endif
+
+int main()
+{
+    boost::detail::splitmix64 rng;
+
+    for( int i = 0; i < 2000; ++i )
+    {
+        std::size_t n = static_cast<std::size_t>( rng() % 300 );
+        int k = 1 + static_cast<int>( rng() % 4 );
+
+        std::string h = random_string( rng, n, 'a', k );
+
+        for( int j = 0; j < 8; ++j )
+        {
+            std::size_t m = 2 + static_cast<std::size_t>( rng() % 70 );
+
+            std::string s;
+
+            if( m <= n && rng() % 2 )
+            {
+                // take the needle from the haystack so that it is found
+                s = h.substr( static_cast<std::size_t>( rng() % ( n - m + 1 ) ), m );
+            }
+            else
+            {
+                s = random_string( rng, m, 'a', k );
+            }
+
+            std::size_t pos = static_cast<std::size_t>( rng() % ( n + 2 ) );
+
+            boost::core::string_view sv( h );
+
+            BOOST_TEST_EQ( sv.find( s ), find_ref( h, s, 0 ) );
+            BOOST_TEST_EQ( sv.find( s, pos ), find_ref( h, s, pos ) );
+            BOOST_TEST_EQ( sv.find( s.c_str(), pos, s.size() ), find_ref( h, s, pos ) );
+        }
+    }
+
+    {
+        // adversarial: the first and last character match everywhere
+
+        std::string h( 4096, 'a' );
+        h += 'b';
+
+        boost::core::string_view sv( h );
+
+        BOOST_TEST_EQ( sv.find( std::string( 40, 'a' ) ), 0 );
+        BOOST_TEST_EQ( sv.find( std::string( 40, 'a' ) + 'b' ), 4096 - 40 );
+        BOOST_TEST_EQ( sv.find( "a" + std::string( 40, 'b' ) + "a" ), boost::core::string_view::npos );
+        BOOST_TEST_EQ( sv.find( "ab" ), 4095 );
+        BOOST_TEST_EQ( sv.find( "ba" ), boost::core::string_view::npos );
+    }
+
+    return boost::report_errors();
+}
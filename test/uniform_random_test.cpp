@@ -0,0 +1,295 @@
+// Test for boost/core/uniform_random.hpp
+//
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/uniform_random.hpp>
+#include <boost/core/xoshiro.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/cstdint.hpp>
+#include <vector>
+#include <cstddef>
+
+static boost::uint64_t u64( boost::uint32_t hi, boost::uint32_t lo )
+{
+    return static_cast<boost::uint64_t>( hi ) << 32 | lo;
+}
+
+// a generator returning the values of an array, then 2^64 - 1,
+// which uniform_below never rejects
+
+struct fixed_generator
+{
+    boost::uint64_t const* p_;
+    std::size_t n_;
+
+    boost::uint64_t operator()()
+    {
+        if( n_ == 0 ) return ~static_cast<boost::uint64_t>( 0 );
+
+        --n_;
+        return *p_++;
+    }
+};
+
+static void test_mul()
+{
+    boost::detail::splitmix64 rng;
+
+    for( int i = 0; i < 1000; ++i )
+    {
+        boost::uint64_t const a = rng(), b = rng() >> ( i % 64 );
+
+        boost::uint64_t hi = 0;
+        boost::uint64_t const lo = boost::core::detail::uniform_mul( a, b, hi );
+
+        // check the product modulo 2^64 and modulo 2^64 - 1
+
+        BOOST_TEST_EQ( lo, a * b );
+
+        boost::uint64_t const m = ~static_cast<boost::uint64_t>( 0 );
+
+        boost::uint64_t r = hi + lo;
+        if( r < hi ) ++r;
+        if( r == m ) r = 0;
+
+        boost::uint64_t const a2 = a == m? 0: a, b2 = b == m? 0: b;
+
+        // a2 * b2 mod m, by doubling
+
+        boost::uint64_t s = 0, x = a2;
+
+        for( boost::uint64_t y = b2; y != 0; y >>= 1 )
+        {
+            if( y & 1 )
+            {
+                s = s >= m - x? s - ( m - x ): s + x;
+            }
+
+            x = x >= m - x? x - ( m - x ): x + x;
+        }
+
+        BOOST_TEST_EQ( r, s );
+    }
+}
+
+template<class G> static void test_below( G g )
+{
+    using namespace boost::core;
+
+    for( int i = 0; i < 10000; ++i )
+    {
+        boost::uint64_t const n = 1 + ( g() >> ( i % 64 ) );
+        BOOST_TEST_LT( uniform_below( g, n ), n );
+    }
+
+    for( int i = 0; i < 1000; ++i )
+    {
+        BOOST_TEST_EQ( uniform_below( g, 1 ), 0u );
+    }
+
+    // for n = 3 * 2^62, a quarter of the values is rejected, and a
+    // reduction modulo n would make [0, 2^62) twice as likely as the
+    // other two thirds
+
+    {
+        boost::uint64_t const n = static_cast<boost::uint64_t>( 3 ) << 62;
+
+        int c[ 3 ] = {};
+
+        for( int i = 0; i < 30000; ++i )
+        {
+            boost::uint64_t const x = uniform_below( g, n );
+
+            BOOST_TEST_LT( x, n );
+            ++c[ x >> 62 ];
+        }
+
+        for( int j = 0; j < 3; ++j )
+        {
+            BOOST_TEST_GT( c[ j ], 9500 );
+            BOOST_TEST_LT( c[ j ], 10500 );
+        }
+    }
+
+    {
+        int c[ 10 ] = {};
+
+        for( int i = 0; i < 100000; ++i )
+        {
+            ++c[ uniform_below( g, 10 ) ];
+        }
+
+        for( int j = 0; j < 10; ++j )
+        {
+            BOOST_TEST_GT( c[ j ], 9500 );
+            BOOST_TEST_LT( c[ j ], 10500 );
+        }
+    }
+}
+
+template<class G> static void test_real( G g )
+{
+    using namespace boost::core;
+
+    double sd = 0;
+    float sf = 0;
+
+    for( int i = 0; i < 10000; ++i )
+    {
+        double const x = uniform_double( g );
+
+        BOOST_TEST_GE( x, 0.0 );
+        BOOST_TEST_LT( x, 1.0 );
+
+        float const y = uniform_float( g );
+
+        BOOST_TEST_GE( y, 0.0f );
+        BOOST_TEST_LT( y, 1.0f );
+
+        sd += x;
+        sf += y;
+    }
+
+    BOOST_TEST_GT( sd, 4900.0 );
+    BOOST_TEST_LT( sd, 5100.0 );
+
+    BOOST_TEST_GT( sf, 4900.0f );
+    BOOST_TEST_LT( sf, 5100.0f );
+}
+
+template<class G> static void test_fill( G g1 )
+{
+#if !defined(BOOST_NO_CXX11_CONSTEXPR) && !defined(BOOST_NO_CXX11_DECLTYPE)
+
+    using namespace boost::core;
+
+    G g2( g1 );
+
+    // the fills give the values of the scalar functions; for uniform_below
+    // this holds when no value is rejected, as for powers of two
+
+    for( std::size_t n = 0; n < 300; n += 1 + n / 8 )
+    {
+        std::vector<boost::uint64_t> v( n + 1, 0 );
+        std::vector<double> vd( n + 1, 0 );
+        std::vector<float> vf( n + 1, 0 );
+
+        boost::uint64_t const m = static_cast<boost::uint64_t>( 1 ) << ( n % 64 );
+
+        uniform_fill( g1, boost::span<boost::uint64_t>( v.data(), n ), m );
+        uniform_fill( g1, boost::span<double>( vd.data(), n ) );
+        uniform_fill( g1, boost::span<float>( vf.data(), n ) );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST_EQ( v[ i ], uniform_below( g2, m ) );
+        }
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST_EQ( vd[ i ], uniform_double( g2 ) );
+        }
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST_EQ( vf[ i ], uniform_float( g2 ) );
+        }
+
+        BOOST_TEST_EQ( v[ n ], 0u );
+        BOOST_TEST_EQ( vd[ n ], 0.0 );
+        BOOST_TEST_EQ( vf[ n ], 0.0f );
+    }
+
+    // with rejections
+
+    {
+        boost::uint64_t const n = static_cast<boost::uint64_t>( 3 ) << 62;
+
+        std::vector<boost::uint64_t> v( 3000 );
+        uniform_fill( g1, boost::span<boost::uint64_t>( v ), n );
+
+        int c[ 3 ] = {};
+
+        for( std::size_t i = 0; i < v.size(); ++i )
+        {
+            BOOST_TEST_LT( v[ i ], n );
+            ++c[ v[ i ] >> 62 ];
+        }
+
+        for( int j = 0; j < 3; ++j )
+        {
+            BOOST_TEST_GT( c[ j ], 850 );
+            BOOST_TEST_LT( c[ j ], 1150 );
+        }
+    }
+
+#else
+
+    (void)g1;
+
+#endif
+}
+
+int main()
+{
+    using namespace boost::core;
+
+    test_mul();
+
+    // exact values: the result is the high half of x * n, and
+    // values whose low half is below 2^64 mod n are rejected
+
+    {
+        boost::uint64_t const x[] = { u64( 0x80000000, 1 ), u64( 0xFFFFFFFF, 0xFFFFFFFF ), u64( 0x20000000, 0 ) };
+
+        fixed_generator g = { x, 3 };
+
+        BOOST_TEST_EQ( uniform_below( g, 10 ), 5u );
+        BOOST_TEST_EQ( uniform_below( g, 10 ), 9u );
+        BOOST_TEST_EQ( uniform_below( g, 10 ), 1u );
+    }
+
+    {
+        // 2^64 mod 3 is 1, so a low half of 0 is rejected
+
+        boost::uint64_t const x[] = { 0, u64( 0x55555555, 0x55555556 ) };
+
+        fixed_generator g = { x, 2 };
+
+        BOOST_TEST_EQ( uniform_below( g, 3 ), 1u );
+    }
+
+    {
+        boost::uint64_t const x[] = { 0, u64( 0xFFFFFFFF, 0xFFFFFFFF ), u64( 0x80000000, 0 ) };
+
+        fixed_generator g = { x, 3 };
+
+        BOOST_TEST_EQ( uniform_double( g ), 0.0 );
+        BOOST_TEST_EQ( uniform_double( g ), 1.0 - 1.0 / 9007199254740992.0 );
+        BOOST_TEST_EQ( uniform_float( g ), 0.5f );
+    }
+
+    {
+        boost::uint64_t const x[] = { u64( 0xFFFFFFFF, 0xFFFFFFFF ) };
+
+        fixed_generator g = { x, 1 };
+
+        BOOST_TEST_EQ( uniform_float( g ), 1.0f - 1.0f / 16777216.0f );
+    }
+
+    test_below( boost::detail::splitmix64() );
+    test_below( xoshiro256ss( 1 ) );
+
+    test_real( boost::detail::splitmix64() );
+    test_real( xoroshiro128p( 1 ) );
+
+    test_fill( boost::detail::splitmix64() );
+    test_fill( xoshiro256ss( 2 ) );
+    test_fill( xoroshiro128p( 2 ) );
+    test_fill( xoshiro256ss_x4( 2 ) );
+
+    return boost::report_errors();
+}
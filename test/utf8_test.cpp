@@ -0,0 +1,227 @@
+// Test for boost/core/utf8.hpp
+//
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/utf8.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/cstdint.hpp>
+#include <string>
+#include <cstddef>
+
+using boost::core::string_view;
+
+std::size_t const npos = string_view::npos;
+
+// reference implementation, decoding the code points
+
+static std::size_t ref_find_invalid( std::string const& s, std::size_t* count )
+{
+    std::size_t const n = s.size();
+    std::size_t k = 0;
+
+    for( std::size_t i = 0; i < n; )
+    {
+        unsigned char const c = static_cast<unsigned char>( s[ i ] );
+
+        std::size_t m = 0;
+        boost::uint32_t cp = 0, min = 0;
+
+        if( c < 0x80 ) { m = 1; cp = c; }
+        else if( ( c & 0xE0 ) == 0xC0 ) { m = 2; cp = c & 0x1F; min = 0x80; }
+        else if( ( c & 0xF0 ) == 0xE0 ) { m = 3; cp = c & 0x0F; min = 0x800; }
+        else if( ( c & 0xF8 ) == 0xF0 ) { m = 4; cp = c & 0x07; min = 0x10000; }
+        else return i;
+
+        if( n - i < m ) return i;
+
+        for( std::size_t j = 1; j < m; ++j )
+        {
+            unsigned char const d = static_cast<unsigned char>( s[ i + j ] );
+            if( ( d & 0xC0 ) != 0x80 ) return i;
+            cp = cp << 6 | ( d & 0x3F );
+        }
+
+        if( cp < min || cp > 0x10FFFF || ( cp >= 0xD800 && cp <= 0xDFFF ) ) return i;
+
+        i += m;
+        ++k;
+    }
+
+    if( count ) *count = k;
+    return npos;
+}
+
+static void append_code_point( std::string& s, boost::uint32_t cp )
+{
+    if( cp < 0x80 )
+    {
+        s += static_cast<char>( cp );
+    }
+    else if( cp < 0x800 )
+    {
+        s += static_cast<char>( 0xC0 | cp >> 6 );
+        s += static_cast<char>( 0x80 | ( cp & 0x3F ) );
+    }
+    else if( cp < 0x10000 )
+    {
+        s += static_cast<char>( 0xE0 | cp >> 12 );
+        s += static_cast<char>( 0x80 | ( cp >> 6 & 0x3F ) );
+        s += static_cast<char>( 0x80 | ( cp & 0x3F ) );
+    }
+    else
+    {
+        s += static_cast<char>( 0xF0 | cp >> 18 );
+        s += static_cast<char>( 0x80 | ( cp >> 12 & 0x3F ) );
+        s += static_cast<char>( 0x80 | ( cp >> 6 & 0x3F ) );
+        s += static_cast<char>( 0x80 | ( cp & 0x3F ) );
+    }
+}
+
+static std::string random_utf8( boost::detail::splitmix64& rng, std::size_t n )
+{
+    // code points near the boundaries of the encoding lengths and of the
+    // surrogate range, and mostly ASCII runs
+
+    static boost::uint32_t const bases[] = { 0x20, 0x80, 0x7FF, 0x800, 0xD7FF, 0xE000, 0xFFFF, 0x10000, 0x10FFFF };
+
+    std::string s;
+
+    while( s.size() < n )
+    {
+        boost::uint64_t const r = rng();
+
+        if( r % 4 != 0 )
+        {
+            s += static_cast<char>( 0x20 + r % 95 );
+        }
+        else
+        {
+            std::size_t const k = static_cast<std::size_t>( r >> 8 ) % ( sizeof( bases ) / sizeof( bases[ 0 ] ) );
+            boost::uint32_t cp = bases[ k ] + static_cast<boost::uint32_t>( r >> 16 & 3 );
+
+            if( cp > 0x10FFFF || ( cp >= 0xD800 && cp <= 0xDFFF ) ) cp = bases[ k ];
+
+            append_code_point( s, cp );
+        }
+    }
+
+    return s;
+}
+
+int main()
+{
+    using namespace boost::core;
+
+    BOOST_TEST( utf8_is_valid( "" ) );
+    BOOST_TEST( utf8_is_valid( "hello" ) );
+    BOOST_TEST( utf8_is_valid( "\xC3\xA9t\xC3\xA9" ) );
+    BOOST_TEST( utf8_is_valid( "\xE2\x82\xAC" ) );
+    BOOST_TEST( utf8_is_valid( "\xF0\x9F\x98\x80" ) );
+    BOOST_TEST( utf8_is_valid( "\xF4\x8F\xBF\xBF" ) );
+    BOOST_TEST( utf8_is_valid( "\xED\x9F\xBF" ) );
+
+    BOOST_TEST_EQ( utf8_find_invalid( "\x80" ), 0u );
+    BOOST_TEST_EQ( utf8_find_invalid( "a\xC0\x80" ), 1u );
+    BOOST_TEST_EQ( utf8_find_invalid( "ab\xC1\xBF" ), 2u );
+    BOOST_TEST_EQ( utf8_find_invalid( "\xE0\x9F\xBF" ), 0u );
+    BOOST_TEST_EQ( utf8_find_invalid( "\xED\xA0\x80" ), 0u );
+    BOOST_TEST_EQ( utf8_find_invalid( "\xF0\x8F\xBF\xBF" ), 0u );
+    BOOST_TEST_EQ( utf8_find_invalid( "\xF4\x90\x80\x80" ), 0u );
+    BOOST_TEST_EQ( utf8_find_invalid( "\xF5\x80\x80\x80" ), 0u );
+    BOOST_TEST_EQ( utf8_find_invalid( "\xFF" ), 0u );
+    BOOST_TEST_EQ( utf8_find_invalid( "abc\xE2\x82" ), 3u );
+    BOOST_TEST_EQ( utf8_find_invalid( "\xE2\x82" "abc" ), 0u );
+    BOOST_TEST_EQ( utf8_find_invalid( "\xC3\xA9\xA9" ), 2u );
+
+    BOOST_TEST_EQ( utf8_count( "" ), 0u );
+    BOOST_TEST_EQ( utf8_count( "abc" ), 3u );
+    BOOST_TEST_EQ( utf8_count( "\xC3\xA9t\xC3\xA9" ), 3u );
+    BOOST_TEST_EQ( utf8_count( "\xF0\x9F\x98\x80\xE2\x82\xAC" ), 2u );
+
+    boost::detail::splitmix64 rng;
+
+    // valid input and counting
+
+    for( int i = 0; i < 2000; ++i )
+    {
+        std::string s = random_utf8( rng, static_cast<std::size_t>( rng() % 300 ) );
+
+        std::size_t count = 0;
+
+        BOOST_TEST_EQ( ref_find_invalid( s, &count ), npos );
+        BOOST_TEST( utf8_is_valid( s ) );
+        BOOST_TEST_EQ( utf8_count( s ), count );
+    }
+
+    // one corrupted or truncated byte
+
+    for( int i = 0; i < 10000; ++i )
+    {
+        std::string s = random_utf8( rng, 1 + static_cast<std::size_t>( rng() % 300 ) );
+
+        std::size_t const j = static_cast<std::size_t>( rng() % s.size() );
+
+        if( rng() & 1 )
+        {
+            s[ j ] = static_cast<char>( rng() & 0xFF );
+        }
+        else
+        {
+            s.resize( j );
+        }
+
+        BOOST_TEST_EQ( utf8_find_invalid( s ), ref_find_invalid( s, 0 ) );
+    }
+
+    // one non-ASCII byte at every position of a long ASCII string,
+    // which checks the errors at and across the block boundaries
+
+    for( std::size_t j = 0; j < 160; ++j )
+    {
+        for( int k = 0; k < 4; ++k )
+        {
+            static char const bad[] = { '\x80', '\xC3', '\xE2', '\xF0' };
+
+            std::string s( 160, 'x' );
+            s[ j ] = bad[ k ];
+
+            BOOST_TEST_EQ( utf8_find_invalid( s ), j );
+
+            s.resize( j + 1 );
+
+            BOOST_TEST_EQ( utf8_find_invalid( s ), j );
+        }
+    }
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+
+    {
+        constexpr std::size_t r1 = utf8_find_invalid( string_view( "ab\xC3\xA9\xFF", 5 ) );
+        constexpr std::size_t r2 = utf8_count( string_view( "ab\xC3\xA9", 4 ) );
+
+        BOOST_TEST_EQ( r1, 4u );
+        BOOST_TEST_EQ( r2, 3u );
+    }
+
+#endif
+
+#if defined(__cpp_char8_t) && __cpp_char8_t >= 201811L
+
+    {
+        u8string_view s1 = u8"\u00E9t\u00E9 \U0001F600";
+
+        BOOST_TEST( utf8_is_valid( s1 ) );
+        BOOST_TEST_EQ( utf8_count( s1 ), 5u );
+
+        char8_t const s2[] = { u8'a', static_cast<char8_t>( 0xC0 ), static_cast<char8_t>( 0x80 ) };
+
+        BOOST_TEST_EQ( utf8_find_invalid( u8string_view( s2, 3 ) ), 1u );
+    }
+
+#endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,237 @@
+// Test for boost/core/xoshiro.hpp
+//
+// Copyright 2026
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/core/xoshiro.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/cstdint.hpp>
+#include <vector>
+#include <cstddef>
+
+static boost::uint64_t u64( boost::uint32_t hi, boost::uint32_t lo )
+{
+    return static_cast<boost::uint64_t>( hi ) << 32 | lo;
+}
+
+template<class G> static void test_common()
+{
+    G g1, g2( 0 ), g3( 1 );
+
+    BOOST_TEST( g1 == g2 );
+    BOOST_TEST( g1 != g3 );
+
+    g3.seed( 0 );
+    BOOST_TEST( g1 == g3 );
+
+    g1();
+    BOOST_TEST( g1 != g2 );
+
+    g2();
+    BOOST_TEST( g1 == g2 );
+
+    // jump() and long_jump() lead to different states, which
+    // depend only on the starting state
+
+    G g4( g1 ), g5( g1 );
+
+    g4.jump();
+    g5.long_jump();
+
+    BOOST_TEST( g4 != g1 );
+    BOOST_TEST( g5 != g1 );
+    BOOST_TEST( g4 != g5 );
+
+    g2.jump();
+    BOOST_TEST( g2 == g4 );
+
+    g3 = g1;
+    g3.long_jump();
+    BOOST_TEST( g3 == g5 );
+
+    BOOST_TEST_EQ( (G::min)(), 0u );
+    BOOST_TEST_EQ( (G::max)(), ~static_cast<boost::uint64_t>( 0 ) );
+}
+
+template<class G> static void test_fill( G g1 )
+{
+#if !defined(BOOST_NO_CXX11_CONSTEXPR) && !defined(BOOST_NO_CXX11_DECLTYPE)
+
+    G g2( g1 );
+
+    for( std::size_t n = 0; n < 40; ++n )
+    {
+        std::vector<boost::uint64_t> v( n + 1, 0 );
+
+        g1.fill( boost::span<boost::uint64_t>( v.data(), n ) );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST_EQ( v[ i ], g2() );
+        }
+
+        BOOST_TEST_EQ( v[ n ], 0u );
+    }
+
+    BOOST_TEST_EQ( g1(), g2() );
+
+#else
+
+    (void)g1;
+
+#endif
+}
+
+int main()
+{
+    using namespace boost::core;
+
+    test_common<xoshiro256ss>();
+    test_common<xoroshiro128p>();
+
+    // reference values from the public domain implementations,
+    // seeded with the outputs of splitmix64
+
+    {
+        xoshiro256ss g;
+
+        BOOST_TEST_EQ( g(), u64( 0x99ec5f36, 0xcb75f2b4 ) );
+        BOOST_TEST_EQ( g(), u64( 0xbf6e1f78, 0x4956452a ) );
+        BOOST_TEST_EQ( g(), u64( 0x1a5f849d, 0x4933e6e0 ) );
+    }
+
+    {
+        xoshiro256ss g( 12345 );
+
+        BOOST_TEST_EQ( g(), u64( 0xbe6a3637, 0x4160d49b ) );
+        BOOST_TEST_EQ( g(), u64( 0x214aaa06, 0x37a688c6 ) );
+        BOOST_TEST_EQ( g(), u64( 0xf69d16de, 0x9954d388 ) );
+    }
+
+    {
+        xoshiro256ss g;
+        g.jump();
+
+        BOOST_TEST_EQ( g(), u64( 0x376215ed, 0xc846d62c ) );
+    }
+
+    {
+        xoshiro256ss g;
+        g.long_jump();
+
+        BOOST_TEST_EQ( g(), u64( 0xe704a522, 0xa72937eb ) );
+    }
+
+    {
+        xoroshiro128p g;
+
+        BOOST_TEST_EQ( g(), u64( 0x509946a4, 0x1cd733a3 ) );
+        BOOST_TEST_EQ( g(), u64( 0xd805fcac, 0x6824536e ) );
+        BOOST_TEST_EQ( g(), u64( 0xdadc02f3, 0xe3cf7be3 ) );
+    }
+
+    {
+        xoroshiro128p g;
+        g.jump();
+
+        BOOST_TEST_EQ( g(), u64( 0x2d6624e4, 0xfb23a138 ) );
+    }
+
+    {
+        xoroshiro128p g;
+        g.long_jump();
+
+        BOOST_TEST_EQ( g(), u64( 0xfa999806, 0xdd90c019 ) );
+    }
+
+    // xoshiro256ss_x4 interleaves four streams, each one jump apart
+
+    {
+        xoshiro256ss g0( 7 ), g1( g0 ), g2, g3;
+
+        g1.jump();
+        g2 = g1; g2.jump();
+        g3 = g2; g3.jump();
+
+        xoshiro256ss_x4 g( 7 ), h( g0 );
+        xoshiro256ss h0( g0 );
+
+        for( int i = 0; i < 37; ++i )
+        {
+            BOOST_TEST_EQ( g(), g0() );
+            BOOST_TEST_EQ( g(), g1() );
+            BOOST_TEST_EQ( g(), g2() );
+            BOOST_TEST_EQ( g(), g3() );
+
+            BOOST_TEST_EQ( h(), h0() );
+
+            h();
+            h();
+            h();
+        }
+    }
+
+    // after jump(), lane 0 continues where lane 3 would be after another jump
+
+    {
+        xoshiro256ss g0( 9 );
+        xoshiro256ss_x4 g( g0 );
+
+        g();
+        g.jump();
+
+        g0();
+        g0.jump();
+        g0.jump();
+        g0.jump();
+        g0.jump();
+
+        BOOST_TEST_EQ( g(), g0() );
+    }
+
+    {
+        xoshiro256ss g0( 9 );
+        xoshiro256ss_x4 g( g0 );
+
+        g.long_jump();
+        g0.long_jump();
+
+        BOOST_TEST_EQ( g(), g0() );
+    }
+
+    {
+        xoshiro256ss_x4 g1, g2( 0 );
+
+        for( int i = 0; i < 10; ++i )
+        {
+            BOOST_TEST_EQ( g1(), g2() );
+        }
+
+        g1.seed( 5 );
+
+        xoshiro256ss_x4 g3( 5 );
+
+        BOOST_TEST_EQ( g1(), g3() );
+    }
+
+    // fill gives the same values as repeated calls, from any position
+    // in the buffer of xoshiro256ss_x4
+
+    test_fill( xoshiro256ss( 3 ) );
+    test_fill( xoroshiro128p( 3 ) );
+
+    for( int i = 0; i < 4; ++i )
+    {
+        xoshiro256ss_x4 g( 3 );
+
+        for( int j = 0; j < i; ++j )
+        {
+            g();
+        }
+
+        test_fill( g );
+    }
+
+    return boost::report_errors();
+}